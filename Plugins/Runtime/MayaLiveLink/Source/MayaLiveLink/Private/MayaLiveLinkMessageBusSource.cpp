@@ -24,6 +24,7 @@
 #include "MayaLiveLinkInterface.h"
 
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 #include "Animation/AnimSequence.h"
 #include "AssetRegistry/AssetData.h"
@@ -57,14 +58,58 @@
 #include "Misc/App.h"
 
 
+namespace
+{
+	TAutoConsoleVariable<float> CVarMayaLiveLinkGameThreadBudgetMs(
+		TEXT("MayaLiveLink.GameThreadBudgetMs"),
+		5.0f,
+		TEXT("Time budget in milliseconds used each tick to apply the animation and level sequence data received from Maya.\n")
+		TEXT("The remaining data is applied on the next ticks. 0 means no limit."));
+
+	TAutoConsoleVariable<float> CVarMayaLiveLinkTimeChangeIntervalMs(
+		TEXT("MayaLiveLink.TimeChangeIntervalMs"),
+		30.0f,
+		TEXT("Minimum time in milliseconds between two time changes sent to Maya.\n")
+		TEXT("Time changes made in between are coalesced so that only the latest time is sent."));
+}
+
 FMayaLiveLinkMessageBusSource::FMayaLiveLinkMessageBusSource(const FText& InSourceType, const FText& InSourceMachineName, const FMessageAddress& InConnectionAddress, double InMachineTimeOffset)
 : FLiveLinkMessageBusSource(InSourceType, InSourceMachineName, InConnectionAddress, InMachineTimeOffset)
 {
+	TimelineMailboxTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMayaLiveLinkMessageBusSource::Tick));
+}
+
+FMayaLiveLinkMessageBusSource::~FMayaLiveLinkMessageBusSource()
+{
+	RemoveTimelineMailboxTicker();
+}
+
+void FMayaLiveLinkMessageBusSource::RemoveTimelineMailboxTicker()
+{
+	if (TimelineMailboxTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TimelineMailboxTickerHandle);
+		TimelineMailboxTickerHandle.Reset();
+	}
+
+	FScopeLock Lock(&TimelineMailboxesCriticalSection);
+	TimelineMailboxes.Empty();
+}
+
+bool FMayaLiveLinkMessageBusSource::Tick(float DeltaTime)
+{
+	if (bHasPendingTimeChangeReturn && CanSendTimeChangeReturn())
+	{
+		SendPendingTimeChangeReturn();
+	}
+
+	return DrainTimelineMailboxes(DeltaTime);
 }
 
 void FMayaLiveLinkMessageBusSource::ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid)
 {
 	FLiveLinkMessageBusSource::ReceiveClient(InClient, InSourceGuid);
+	LiveLinkClient = InClient;
 
 	if (IsMessageEndpointConnected())
 	{
@@ -110,13 +155,11 @@ void FMayaLiveLinkMessageBusSource::InitializeAndPushStaticData_AnyThread(FName
 		}
 
 		// Keep a copy of the static data and push it on the game thread.
-		// Creating an animation sequence and looking for assets must happen on the game thread.
+		// Creating an animation sequence and looking for assets must happen on the game thread,
+		// in order with the frame data of the subject.
 		TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataStruct = MakeShareable(new FLiveLinkStaticDataStruct(MessageTypeInfo));
 		StaticDataStruct->InitializeWith(MessageTypeInfo, Message);
-		AsyncTask(ENamedThreads::GameThread, [this, SubjectName, StaticDataStruct]()
-		{
-			PushStaticDataToAnimSequence(SubjectName, StaticDataStruct);
-		});
+		EnqueueTimelineData(SubjectName, StaticDataStruct, nullptr);
 
 		FLiveLinkStaticDataStruct DataStruct(MessageTypeInfo);
 		PushClientSubjectStaticData_AnyThread(SubjectKey, SubjectRole, MoveTemp(DataStruct));
@@ -150,17 +193,56 @@ void FMayaLiveLinkMessageBusSource::InitializeAndPushStaticData_AnyThread(FName
 		DummyStaticData->StartFrame = StaticData.StartFrame;
 		DummyStaticData->EndFrame = StaticData.EndFrame;
 
-		AsyncTask(ENamedThreads::GameThread, [this, SubjectName, StaticDataStruct]()
-		{
-			PushStaticDataToLevelSequence(SubjectName, StaticDataStruct);
-		});
+		EnqueueTimelineData(SubjectName, StaticDataStruct, nullptr);
 
 		PushClientSubjectStaticData_AnyThread(SubjectKey, SubjectRole, MoveTemp(DataStruct));
 	}
 	else
 	{
+		// Maya sends the same static data again on reconnects and rebuilds,
+		// skip the re-registration of the subject when nothing changed
+		const uint32 StaticDataHash = FMayaLiveLinkInterfaceModule::GetStaticDataHash(MessageTypeInfo, Message);
+		if (IsStaticDataCached(SubjectName, SubjectRole, SubjectKey, StaticDataHash))
+		{
+			return;
+		}
+
 		FLiveLinkMessageBusSource::InitializeAndPushStaticData_AnyThread(SubjectName, SubjectRole, SubjectKey, Context, MessageTypeInfo);
+		CacheStaticDataHash(SubjectName, StaticDataHash);
+	}
+}
+
+bool FMayaLiveLinkMessageBusSource::IsStaticDataCached(FName SubjectName,
+													   TSubclassOf<ULiveLinkRole> SubjectRole,
+													   const FLiveLinkSubjectKey& SubjectKey,
+													   uint32 StaticDataHash)
+{
+	{
+		FScopeLock Lock(&StaticDataHashesCriticalSection);
+		const uint32* CachedHash = StaticDataHashes.Find(SubjectName);
+		if (!CachedHash || *CachedHash != StaticDataHash)
+		{
+			return false;
+		}
+	}
+
+	// The subject could have been removed from the client since the static data was cached
+	return LiveLinkClient && LiveLinkClient->GetSubjectRole_AnyThread(SubjectKey) == SubjectRole;
+}
+
+void FMayaLiveLinkMessageBusSource::CacheStaticDataHash(FName SubjectName, uint32 StaticDataHash)
+{
+	FScopeLock Lock(&StaticDataHashesCriticalSection);
+	if (!StaticDataHashes.Contains(SubjectName))
+	{
+		if (StaticDataHashOrder.Num() >= MaxCachedStaticDataHashes)
+		{
+			StaticDataHashes.Remove(StaticDataHashOrder[0]);
+			StaticDataHashOrder.RemoveAt(0);
+		}
+		StaticDataHashOrder.Add(SubjectName);
 	}
+	StaticDataHashes.Add(SubjectName, StaticDataHash);
 }
 
 void FMayaLiveLinkMessageBusSource::InitializeAndPushFrameData_AnyThread(FName SubjectName,
@@ -173,47 +255,26 @@ void FMayaLiveLinkMessageBusSource::InitializeAndPushFrameData_AnyThread(FName S
 	FLiveLinkFrameDataStruct DataStruct(MessageTypeInfo);
 	const FLiveLinkBaseFrameData* Message = reinterpret_cast<const FLiveLinkBaseFrameData*>(Context->GetMessage());
 
-	if (MessageTypeInfo->IsChildOf(FMayaLiveLinkAnimSequenceFrameData::StaticStruct()))
+	if (MessageTypeInfo->IsChildOf(FMayaLiveLinkAnimSequenceFrameData::StaticStruct()) ||
+		MessageTypeInfo->IsChildOf(FMayaLiveLinkAnimSequenceTrackFrameData::StaticStruct()))
 	{
-		// Keep a copy of the frame data and push it on the game thread.
+		// Keep a copy of the frame data and push it on the game thread through the subject's mailbox.
 		// Updating an animation sequence and looking for assets must happen on the game thread.
 		TSharedPtr<FLiveLinkFrameDataStruct, ESPMode::ThreadSafe> FrameDataStruct = MakeShareable(new FLiveLinkFrameDataStruct(MessageTypeInfo));
 		FrameDataStruct->InitializeWith(MessageTypeInfo, Message);
 		FrameDataStruct->GetBaseData()->WorldTime = Message->WorldTime.GetOffsettedTime();
-
-		FScopeLock Lock(&SubjectTimelineParamsCriticalSection);
-		if (auto TimelineParams = SubjectTimelineParams.Find(SubjectName))
-		{
-			TSharedPtr<FMayaLiveLinkAnimSequenceParams, ESPMode::ThreadSafe> TimelineParamsDup = MakeShareable(new FMayaLiveLinkAnimSequenceParams(*TimelineParams));
-			AsyncTask(ENamedThreads::GameThread, [this, FrameDataStruct, TimelineParamsDup]()
-			{
-				auto FrameDataPtr = FrameDataStruct.Get();
-				UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(*FrameDataPtr->Cast<FMayaLiveLinkAnimSequenceFrameData>(),
-																			 *TimelineParamsDup.Get());
-			});
-		}
+		EnqueueTimelineData(SubjectName, nullptr, FrameDataStruct);
 		DataStruct.GetBaseData()->WorldTime = Message->WorldTime.GetOffsettedTime();
 		PushClientSubjectFrameData_AnyThread(SubjectKey, MoveTemp(DataStruct));
 	}
 	else if (MessageTypeInfo->IsChildOf(FMayaLiveLinkLevelSequenceFrameData::StaticStruct()))
 	{
-		// Keep a copy of the frame data and push it on the game thread.
+		// Keep a copy of the frame data and push it on the game thread through the subject's mailbox.
 		// Updating an animation sequence and looking for assets must happen on the game thread.
 		TSharedPtr<FLiveLinkFrameDataStruct, ESPMode::ThreadSafe> FrameDataStruct = MakeShareable(new FLiveLinkFrameDataStruct(MessageTypeInfo));
 		FrameDataStruct->InitializeWith(MessageTypeInfo, Message);
 		FrameDataStruct->GetBaseData()->WorldTime = Message->WorldTime.GetOffsettedTime();
-
-		FScopeLock Lock(&SubjectTimelineParamsCriticalSection);
-		if (auto SequenceParams = SubjectLevelSequenceParams.Find(SubjectName))
-		{
-			TSharedPtr<FMayaLiveLinkLevelSequenceParams, ESPMode::ThreadSafe> SequenceParamsDup = MakeShareable(new FMayaLiveLinkLevelSequenceParams(*SequenceParams));
-			AsyncTask(ENamedThreads::GameThread, [this, FrameDataStruct, SequenceParamsDup]()
-			{
-				auto FrameDataPtr = FrameDataStruct.Get();
-				UMayaLiveLinkLevelSequenceHelper::PushFrameDataToLevelSequence(*FrameDataPtr->Cast<FMayaLiveLinkLevelSequenceFrameData>(),
-																			   *SequenceParamsDup.Get());
-			});
-		}
+		EnqueueTimelineData(SubjectName, nullptr, FrameDataStruct);
 		DataStruct.GetBaseData()->WorldTime = Message->WorldTime.GetOffsettedTime();
 		PushClientSubjectFrameData_AnyThread(SubjectKey, MoveTemp(DataStruct));
 	}
@@ -465,11 +526,36 @@ void FMayaLiveLinkMessageBusSource::HandleTimeChangeRequest(const FMayaLiveLinkT
 
 void FMayaLiveLinkMessageBusSource::HandleTimeChangeReturn(const FQualifiedFrameTime& Time)
 {
+	// Scrubbing changes the time on every editor frame, only the latest time is sent once per interval
+	PendingTimeChangeReturn = Time;
+	bHasPendingTimeChangeReturn = true;
+	if (CanSendTimeChangeReturn())
+	{
+		SendPendingTimeChangeReturn();
+	}
+}
+
+bool FMayaLiveLinkMessageBusSource::CanSendTimeChangeReturn() const
+{
+	const double IntervalSeconds = FMath::Max(0.0f, CVarMayaLiveLinkTimeChangeIntervalMs.GetValueOnGameThread()) / 1000.0;
+	return FPlatformTime::Seconds() - TimeChangeReturnSentTime >= IntervalSeconds;
+}
+
+void FMayaLiveLinkMessageBusSource::SendPendingTimeChangeReturn()
+{
+	if (!bHasPendingTimeChangeReturn)
+	{
+		return;
+	}
+	bHasPendingTimeChangeReturn = false;
+
 	if (IsMessageEndpointConnected())
 	{
 		auto Message = FMessageEndpoint::MakeMessage<FMayaLiveLinkTimeChangeReturnMessage>();
-		Message->Time = Time;
+		Message->Time = PendingTimeChangeReturn;
 		SendMessage(Message);
+
+		TimeChangeReturnSentTime = FPlatformTime::Seconds();
 	}
 }
 /* TODO PLB
@@ -503,9 +589,344 @@ bool FMayaLiveLinkMessageBusSource::RequestSourceShutdown()
 	FMayaLiveLinkTimelineSyncModule::GetModule().GetOnTimeChangedDelegate().RemoveAll(this);
 	FMayaLiveLinkTimelineSyncModule::GetModule().RemoveAllAnimSequenceStartFrames();
 
+	RemoveTimelineMailboxTicker();
+
 	return FLiveLinkMessageBusSource::RequestSourceShutdown();
 }
 
+void FMayaLiveLinkMessageBusSource::EnqueueTimelineData(const FName& SubjectName,
+														TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataPtr,
+														TSharedPtr<FLiveLinkFrameDataStruct, ESPMode::ThreadSafe> FrameDataPtr)
+{
+	FScopeLock Lock(&TimelineMailboxesCriticalSection);
+	TArray<FTimelineMailboxEntry>& Mailbox = TimelineMailboxes.FindOrAdd(SubjectName);
+
+	// Merge the frame data with the last unconsumed frame data of the subject instead of queuing it
+	if (FrameDataPtr && Mailbox.Num() > 0)
+	{
+		FTimelineMailboxEntry& LastEntry = Mailbox.Last();
+		if (LastEntry.FrameData && !LastEntry.Preparation.IsValid() &&
+			LastEntry.FrameData->GetStruct() == FrameDataPtr->GetStruct() &&
+			MergeTimelineFrameData(*LastEntry.FrameData, *FrameDataPtr))
+		{
+			return;
+		}
+	}
+
+	FTimelineMailboxEntry& Entry = Mailbox.AddDefaulted_GetRef();
+	Entry.StaticData = StaticDataPtr;
+	Entry.FrameData = FrameDataPtr;
+}
+
+bool FMayaLiveLinkMessageBusSource::MergeTimelineFrameData(FLiveLinkFrameDataStruct& PendingData, FLiveLinkFrameDataStruct& NewData)
+{
+	if (auto NewLevelSequenceData = NewData.Cast<FMayaLiveLinkLevelSequenceFrameData>())
+	{
+		// Level sequence data contains whole curves, the newer curves replace the pending ones
+		auto& PendingLevelSequenceData = *PendingData.Cast<FMayaLiveLinkLevelSequenceFrameData>();
+		for (auto& CurvePair : NewLevelSequenceData->Curves)
+		{
+			PendingLevelSequenceData.Curves.Add(CurvePair.Key, MoveTemp(CurvePair.Value));
+		}
+		PendingLevelSequenceData.WorldTime = NewLevelSequenceData->WorldTime;
+		return true;
+	}
+
+	if (auto NewTrackData = NewData.Cast<FMayaLiveLinkAnimSequenceTrackFrameData>())
+	{
+		return MergeTimelineTrackFrameData(*PendingData.Cast<FMayaLiveLinkAnimSequenceTrackFrameData>(), *NewTrackData);
+	}
+
+	auto NewAnimSequenceData = NewData.Cast<FMayaLiveLinkAnimSequenceFrameData>();
+	if (!NewAnimSequenceData)
+	{
+		return false;
+	}
+
+	// Anim sequence frames can't be dropped, merge them only when the frame ranges overlap or are adjacent.
+	// The chunks of a long bake are kept separate so that they are applied as they arrive.
+	auto& PendingAnimSequenceData = *PendingData.Cast<FMayaLiveLinkAnimSequenceFrameData>();
+	if (!PendingAnimSequenceData.bFinalChunk || !NewAnimSequenceData->bFinalChunk)
+	{
+		return false;
+	}
+
+	const int32 PendingStart = PendingAnimSequenceData.StartFrame;
+	const int32 PendingEnd = PendingStart + PendingAnimSequenceData.Frames.Num() - 1;
+	const int32 NewStart = NewAnimSequenceData->StartFrame;
+	const int32 NewEnd = NewStart + NewAnimSequenceData->Frames.Num() - 1;
+	if (PendingAnimSequenceData.Frames.Num() > 0 && NewAnimSequenceData->Frames.Num() > 0 &&
+		(NewStart > PendingEnd + 1 || NewEnd < PendingStart - 1))
+	{
+		return false;
+	}
+
+	if (NewAnimSequenceData->Frames.Num() > 0)
+	{
+		if (PendingAnimSequenceData.Frames.Num() == 0)
+		{
+			PendingAnimSequenceData.StartFrame = NewStart;
+			PendingAnimSequenceData.Frames = MoveTemp(NewAnimSequenceData->Frames);
+		}
+		else
+		{
+			const int32 MergedStart = FMath::Min(PendingStart, NewStart);
+			const int32 MergedEnd = FMath::Max(PendingEnd, NewEnd);
+
+			TArray<FMayaLiveLinkAnimSequenceFrame> MergedFrames;
+			MergedFrames.SetNum(MergedEnd - MergedStart + 1);
+			for (int32 Index = 0; Index < PendingAnimSequenceData.Frames.Num(); ++Index)
+			{
+				MergedFrames[PendingStart - MergedStart + Index] = MoveTemp(PendingAnimSequenceData.Frames[Index]);
+			}
+			for (int32 Index = 0; Index < NewAnimSequenceData->Frames.Num(); ++Index)
+			{
+				MergedFrames[NewStart - MergedStart + Index] = MoveTemp(NewAnimSequenceData->Frames[Index]);
+			}
+
+			PendingAnimSequenceData.StartFrame = MergedStart;
+			PendingAnimSequenceData.Frames = MoveTemp(MergedFrames);
+		}
+	}
+
+	for (auto& CurvePair : NewAnimSequenceData->Curves)
+	{
+		PendingAnimSequenceData.Curves.Add(CurvePair.Key, MoveTemp(CurvePair.Value));
+	}
+	PendingAnimSequenceData.WorldTime = NewAnimSequenceData->WorldTime;
+	return true;
+}
+
+bool FMayaLiveLinkMessageBusSource::MergeTimelineTrackFrameData(FMayaLiveLinkAnimSequenceTrackFrameData& PendingData,
+																 FMayaLiveLinkAnimSequenceTrackFrameData& NewData)
+{
+	// Same rules as the frame-major layout, the tracks must also have the same size to be merged
+	const int32 PendingEnd = PendingData.StartFrame + PendingData.NumFrames - 1;
+	const int32 NewEnd = NewData.StartFrame + NewData.NumFrames - 1;
+	if (!PendingData.IsValid() || !NewData.IsValid() ||
+		!PendingData.bFinalChunk || !NewData.bFinalChunk ||
+		PendingData.NumBones != NewData.NumBones ||
+		PendingData.NumCurves != NewData.NumCurves ||
+		(PendingData.NumFrames > 0 && NewData.NumFrames > 0 &&
+		 (NewData.StartFrame > PendingEnd + 1 || NewEnd < PendingData.StartFrame - 1)))
+	{
+		return false;
+	}
+
+	if (NewData.NumFrames > 0)
+	{
+		if (PendingData.NumFrames == 0)
+		{
+			PendingData.StartFrame = NewData.StartFrame;
+			PendingData.NumFrames = NewData.NumFrames;
+			PendingData.Locations = MoveTemp(NewData.Locations);
+			PendingData.Rotations = MoveTemp(NewData.Rotations);
+			PendingData.Scales = MoveTemp(NewData.Scales);
+			PendingData.CurveValues = MoveTemp(NewData.CurveValues);
+		}
+		else
+		{
+			const int32 MergedStart = FMath::Min(PendingData.StartFrame, NewData.StartFrame);
+			const int32 MergedEnd = FMath::Max(PendingEnd, NewEnd);
+
+			FMayaLiveLinkAnimSequenceTrackFrameData MergedData;
+			MergedData.Initialize(MergedStart, MergedEnd - MergedStart + 1, PendingData.NumBones, PendingData.NumCurves);
+
+			// Copy the pending frames first so that the newer frames overwrite them
+			auto CopyTracks = [&MergedData](const FMayaLiveLinkAnimSequenceTrackFrameData& SourceData)
+			{
+				const int32 FrameOffset = SourceData.StartFrame - MergedData.StartFrame;
+				for (int32 BoneIndex = 0; BoneIndex < SourceData.NumBones; ++BoneIndex)
+				{
+					const int32 SourceIndex = SourceData.GetIndex(BoneIndex, 0);
+					const int32 MergedIndex = MergedData.GetIndex(BoneIndex, FrameOffset);
+					FMemory::Memcpy(&MergedData.Locations[MergedIndex], &SourceData.Locations[SourceIndex], SourceData.NumFrames * sizeof(FVector));
+					FMemory::Memcpy(&MergedData.Rotations[MergedIndex], &SourceData.Rotations[SourceIndex], SourceData.NumFrames * sizeof(FQuat));
+					FMemory::Memcpy(&MergedData.Scales[MergedIndex], &SourceData.Scales[SourceIndex], SourceData.NumFrames * sizeof(FVector));
+				}
+				for (int32 CurveIndex = 0; CurveIndex < SourceData.NumCurves; ++CurveIndex)
+				{
+					FMemory::Memcpy(&MergedData.CurveValues[MergedData.GetIndex(CurveIndex, FrameOffset)],
+									&SourceData.CurveValues[SourceData.GetIndex(CurveIndex, 0)],
+									SourceData.NumFrames * sizeof(float));
+				}
+			};
+			CopyTracks(PendingData);
+			CopyTracks(NewData);
+
+			PendingData.StartFrame = MergedData.StartFrame;
+			PendingData.NumFrames = MergedData.NumFrames;
+			PendingData.Locations = MoveTemp(MergedData.Locations);
+			PendingData.Rotations = MoveTemp(MergedData.Rotations);
+			PendingData.Scales = MoveTemp(MergedData.Scales);
+			PendingData.CurveValues = MoveTemp(MergedData.CurveValues);
+		}
+	}
+
+	for (auto& CurvePair : NewData.Curves)
+	{
+		PendingData.Curves.Add(CurvePair.Key, MoveTemp(CurvePair.Value));
+	}
+	PendingData.WorldTime = NewData.WorldTime;
+	return true;
+}
+
+bool FMayaLiveLinkMessageBusSource::DrainTimelineMailboxes(float DeltaTime)
+{
+	const double BudgetSeconds = FMath::Max(0.0f, CVarMayaLiveLinkGameThreadBudgetMs.GetValueOnGameThread()) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FName> SubjectNames;
+	{
+		FScopeLock Lock(&TimelineMailboxesCriticalSection);
+		TimelineMailboxes.GenerateKeyArray(SubjectNames);
+	}
+
+	// Take one entry per subject at a time so that a long sequence doesn't starve the other subjects
+	bool bHasPendingData = SubjectNames.Num() > 0;
+	while (bHasPendingData)
+	{
+		bHasPendingData = false;
+		for (int32 Index = 0; Index < SubjectNames.Num(); ++Index)
+		{
+			const FName& SubjectName = SubjectNames[(Index + TimelineMailboxDrainIndex) % SubjectNames.Num()];
+
+			FTimelineMailboxEntry Entry;
+			{
+				FScopeLock Lock(&TimelineMailboxesCriticalSection);
+				TArray<FTimelineMailboxEntry>* Mailbox = TimelineMailboxes.Find(SubjectName);
+				if (!Mailbox || Mailbox->Num() == 0)
+				{
+					continue;
+				}
+
+				// Wait for the worker thread to finish preparing the data before committing it
+				if (!PrepareTimelineData(SubjectName, (*Mailbox)[0]))
+				{
+					continue;
+				}
+
+				Entry = MoveTemp((*Mailbox)[0]);
+				Mailbox->RemoveAt(0, 1, false);
+				if (Mailbox->Num() == 0)
+				{
+					TimelineMailboxes.Remove(SubjectName);
+				}
+				else
+				{
+					bHasPendingData = true;
+				}
+			}
+
+			ApplyTimelineData(SubjectName, Entry);
+
+			if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				// Resume with the next subject on the next tick
+				TimelineMailboxDrainIndex = (Index + TimelineMailboxDrainIndex + 1) % SubjectNames.Num();
+				return true;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FMayaLiveLinkMessageBusSource::PrepareTimelineData(const FName& SubjectName, FTimelineMailboxEntry& Entry)
+{
+	if (Entry.Preparation.IsValid())
+	{
+		return Entry.Preparation.IsReady();
+	}
+
+	if (!Entry.FrameData ||
+		(!Entry.FrameData->Cast<FMayaLiveLinkAnimSequenceFrameData>() &&
+		 !Entry.FrameData->Cast<FMayaLiveLinkAnimSequenceTrackFrameData>()))
+	{
+		return true;
+	}
+
+	{
+		FScopeLock Lock(&SubjectTimelineParamsCriticalSection);
+		auto TimelineParams = SubjectTimelineParams.Find(SubjectName);
+		if (!TimelineParams)
+		{
+			return true;
+		}
+		Entry.PreparedParams = MakeShareable(new FMayaLiveLinkAnimSequenceParams(*TimelineParams));
+	}
+
+	// Transposing the frames and building the key arrays doesn't need the game thread.
+	// The worker only touches the data it captures so the source can be destroyed while it runs.
+	Entry.PreparedData = MakeShareable(new FMayaLiveLinkAnimSequencePreparedData());
+	Entry.Preparation = Async(EAsyncExecution::TaskGraph,
+							  [FrameData = Entry.FrameData, TimelineParams = Entry.PreparedParams, PreparedData = Entry.PreparedData]()
+	{
+		if (auto TrackFrameData = FrameData->Cast<FMayaLiveLinkAnimSequenceTrackFrameData>())
+		{
+			UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence(*TrackFrameData, *TimelineParams, *PreparedData);
+		}
+		else
+		{
+			UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence(*FrameData->Cast<FMayaLiveLinkAnimSequenceFrameData>(),
+																			 *TimelineParams,
+																			 *PreparedData);
+		}
+	});
+	return false;
+}
+
+void FMayaLiveLinkMessageBusSource::ApplyTimelineData(const FName& SubjectName, const FTimelineMailboxEntry& Entry)
+{
+	if (Entry.StaticData)
+	{
+		if (Entry.StaticData->Cast<FMayaLiveLinkAnimSequenceStaticData>())
+		{
+			PushStaticDataToAnimSequence(SubjectName, Entry.StaticData);
+		}
+		else if (Entry.StaticData->Cast<FMayaLiveLinkLevelSequenceStaticData>())
+		{
+			PushStaticDataToLevelSequence(SubjectName, Entry.StaticData);
+		}
+	}
+	else if (Entry.FrameData)
+	{
+		// The parameters are read when the data is applied, after the static data that preceded it
+		if (Entry.PreparedData)
+		{
+			UMayaLiveLinkAnimSequenceHelper::CommitFrameDataToAnimSequence(*Entry.PreparedData, *Entry.PreparedParams);
+		}
+		else if (auto AnimSequenceFrameData = Entry.FrameData->Cast<FMayaLiveLinkAnimSequenceFrameData>())
+		{
+			FMayaLiveLinkAnimSequenceParams TimelineParams;
+			{
+				FScopeLock Lock(&SubjectTimelineParamsCriticalSection);
+				auto Params = SubjectTimelineParams.Find(SubjectName);
+				if (!Params)
+				{
+					return;
+				}
+				TimelineParams = *Params;
+			}
+			UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(*AnimSequenceFrameData, TimelineParams);
+		}
+		else if (auto LevelSequenceFrameData = Entry.FrameData->Cast<FMayaLiveLinkLevelSequenceFrameData>())
+		{
+			FMayaLiveLinkLevelSequenceParams SequenceParams;
+			{
+				FScopeLock Lock(&SubjectTimelineParamsCriticalSection);
+				auto Params = SubjectLevelSequenceParams.Find(SubjectName);
+				if (!Params)
+				{
+					return;
+				}
+				SequenceParams = *Params;
+			}
+			UMayaLiveLinkLevelSequenceHelper::PushFrameDataToLevelSequence(*LevelSequenceFrameData, SequenceParams);
+		}
+	}
+}
+
 void FMayaLiveLinkMessageBusSource::PushStaticDataToAnimSequence(const FName& SubjectName,
 																 TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataPtr)
 {
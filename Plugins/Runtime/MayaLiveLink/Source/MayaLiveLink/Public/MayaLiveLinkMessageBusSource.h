@@ -28,12 +28,15 @@
 #include "IMessageContext.h"
 #include "LiveLinkRole.h"
 #include "MessageEndpoint.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
 #include "Roles/MayaLiveLinkTimelineTypes.h"
 
 class MAYALIVELINK_API FMayaLiveLinkMessageBusSource : public FLiveLinkMessageBusSource
 {
 public:
 	FMayaLiveLinkMessageBusSource(const FText& InSourceType, const FText& InSourceMachineName, const FMessageAddress& InConnectionAddress, double InMachineTimeOffset);
+	virtual ~FMayaLiveLinkMessageBusSource();
 
 	//~ Begin ILiveLinkSource interface
 	virtual void ReceiveClient(ILiveLinkClient* InClient, FGuid InSourceGuid) override;
@@ -69,15 +72,67 @@ private:
 	void HandleTimeChangeReturn(const FQualifiedFrameTime& Time);
 	//~ End Message bus message handlers
 
+	bool CanSendTimeChangeReturn() const;
+	void SendPendingTimeChangeReturn();
+	bool Tick(float DeltaTime);
+
 	void PushStaticDataToAnimSequence(const FName& SubjectName,
 									  TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataPtr);
 	void PushStaticDataToLevelSequence(const FName& SubjectName,
 									  TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataPtr);
 
+	// Pending anim/level sequence data of a subject, applied on the game thread in arrival order
+	struct FTimelineMailboxEntry
+	{
+		TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticData;
+		TSharedPtr<FLiveLinkFrameDataStruct, ESPMode::ThreadSafe> FrameData;
+
+		// Anim sequence frame data is prepared on a worker thread before being committed on the game thread
+		TSharedPtr<struct FMayaLiveLinkAnimSequencePreparedData, ESPMode::ThreadSafe> PreparedData;
+		TSharedPtr<FMayaLiveLinkAnimSequenceParams, ESPMode::ThreadSafe> PreparedParams;
+		TFuture<void> Preparation;
+	};
+
+	void EnqueueTimelineData(const FName& SubjectName,
+							 TSharedPtr<FLiveLinkStaticDataStruct, ESPMode::ThreadSafe> StaticDataPtr,
+							 TSharedPtr<FLiveLinkFrameDataStruct, ESPMode::ThreadSafe> FrameDataPtr);
+	static bool MergeTimelineFrameData(FLiveLinkFrameDataStruct& PendingData, FLiveLinkFrameDataStruct& NewData);
+	static bool MergeTimelineTrackFrameData(FMayaLiveLinkAnimSequenceTrackFrameData& PendingData,
+											FMayaLiveLinkAnimSequenceTrackFrameData& NewData);
+	bool DrainTimelineMailboxes(float DeltaTime);
+	bool PrepareTimelineData(const FName& SubjectName, FTimelineMailboxEntry& Entry);
+	void ApplyTimelineData(const FName& SubjectName, const FTimelineMailboxEntry& Entry);
+	void RemoveTimelineMailboxTicker();
+
+	bool IsStaticDataCached(FName SubjectName,
+							TSubclassOf<ULiveLinkRole> SubjectRole,
+							const FLiveLinkSubjectKey& SubjectKey,
+							uint32 StaticDataHash);
+	void CacheStaticDataHash(FName SubjectName, uint32 StaticDataHash);
+
 private:
 	TMap<FName, FMayaLiveLinkAnimSequenceParams> SubjectTimelineParams;
 	TMap<FName, FMayaLiveLinkLevelSequenceParams> SubjectLevelSequenceParams;
 
 	// Lock to stop multiple threads accessing the Subjects from the collection at the same time
 	FCriticalSection SubjectTimelineParamsCriticalSection;
+
+	// Per-subject mailboxes drained once per tick under the MayaLiveLink.GameThreadBudgetMs budget
+	TMap<FName, TArray<FTimelineMailboxEntry>> TimelineMailboxes;
+	FCriticalSection TimelineMailboxesCriticalSection;
+	FTSTicker::FDelegateHandle TimelineMailboxTickerHandle;
+	int32 TimelineMailboxDrainIndex = 0;
+
+	// Latest editor time not sent to Maya yet, only accessed on the game thread
+	FQualifiedFrameTime PendingTimeChangeReturn;
+	double TimeChangeReturnSentTime = 0.0;
+	bool bHasPendingTimeChangeReturn = false;
+
+	// Bounded cache of the static data hash of each subject, oldest entries are evicted first
+	static constexpr int32 MaxCachedStaticDataHashes = 1024;
+	TMap<FName, uint32> StaticDataHashes;
+	TArray<FName> StaticDataHashOrder;
+	FCriticalSection StaticDataHashesCriticalSection;
+
+	ILiveLinkClient* LiveLinkClient = nullptr;
 };
\ No newline at end of file
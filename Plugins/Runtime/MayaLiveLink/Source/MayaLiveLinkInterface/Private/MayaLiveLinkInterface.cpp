@@ -22,6 +22,9 @@
 
 #include "MayaLiveLinkInterface.h"
 
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Class.h"
 #include "UObject/ObjectMacros.h"
 
 #include "Runtime/Launch/Resources/Version.h"
@@ -56,4 +59,19 @@ const FString& FMayaLiveLinkInterfaceModule::GetEngineVersion()
 	return UnrealEngineVersion;
 }
 
+uint32 FMayaLiveLinkInterfaceModule::GetStaticDataHash(const UScriptStruct* Struct, const void* StaticData)
+{
+	if (!Struct || !StaticData)
+	{
+		return 0;
+	}
+
+	// Names are serialized as strings by the memory writer, so the hash doesn't depend on the process
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Struct->SerializeBin(Writer, const_cast<void*>(StaticData));
+
+	return FCrc::MemCrc32(Bytes.GetData(), Bytes.Num(), FCrc::StrCrc32(*Struct->GetName()));
+}
+
 #undef LOCTEXT_NAMESPACE
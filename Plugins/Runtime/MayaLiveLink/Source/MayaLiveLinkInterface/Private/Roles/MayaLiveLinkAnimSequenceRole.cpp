@@ -64,4 +64,30 @@ bool UMayaLiveLinkAnimSequenceRole::IsFrameDataValid(const FLiveLinkStaticDataSt
 	return Super::IsFrameDataValid(InStaticData, InFrameData, bOutShouldLogWarning);
 }
 
+/**
+* UMayaLiveLinkAnimSequenceTrackRole
+*/
+UScriptStruct* UMayaLiveLinkAnimSequenceTrackRole::GetFrameDataStruct() const
+{
+	return FMayaLiveLinkAnimSequenceTrackFrameData::StaticStruct();
+}
+
+FText UMayaLiveLinkAnimSequenceTrackRole::GetDisplayName() const
+{
+	return LOCTEXT("AnimSequenceTrackRole", "AnimSequence (Track)");
+}
+
+bool UMayaLiveLinkAnimSequenceTrackRole::IsFrameDataValid(const FLiveLinkStaticDataStruct& InStaticData,
+													  const FLiveLinkFrameDataStruct& InFrameData,
+													  bool& bOutShouldLogWarning) const
+{
+	bool bResult = Super::IsFrameDataValid(InStaticData, InFrameData, bOutShouldLogWarning);
+	if (bResult)
+	{
+		const FMayaLiveLinkAnimSequenceTrackFrameData* FrameData = InFrameData.Cast<FMayaLiveLinkAnimSequenceTrackFrameData>();
+		bResult = FrameData && FrameData->IsValid();
+	}
+	return bResult;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -53,4 +53,15 @@ public:
 
 	static MAYALIVELINKINTERFACE_API const FString& GetPluginVersion();
 	static MAYALIVELINKINTERFACE_API const FString& GetEngineVersion();
+
+	/**
+	* Compute a hash of the content of a static data struct.
+	* The same data produces the same hash in Maya and in the editor, which lets both sides
+	* detect static data that was already sent.
+	*
+	* @param Struct		The type of the static data
+	* @param StaticData	The static data
+	* @return			The content hash of the static data
+	*/
+	static MAYALIVELINKINTERFACE_API uint32 GetStaticDataHash(const UScriptStruct* Struct, const void* StaticData);
 };
@@ -52,3 +52,22 @@ public:
 								  bool& bOutShouldLogWarning) const override;
 	//~ End ULiveLinkRole interface
 };
+
+/**
+* Role associated for Animation timeline data sent with a track-major layout.
+*/
+UCLASS(BlueprintType, meta = (DisplayName = "AnimSequence Track Role"))
+class MAYALIVELINKINTERFACE_API UMayaLiveLinkAnimSequenceTrackRole : public UMayaLiveLinkAnimSequenceRole
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin ULiveLinkRole interface
+	virtual UScriptStruct* GetFrameDataStruct() const override;
+
+	virtual FText GetDisplayName() const override;
+	virtual bool IsFrameDataValid(const FLiveLinkStaticDataStruct& InStaticData,
+								  const FLiveLinkFrameDataStruct& InFrameData,
+								  bool& bOutShouldLogWarning) const override;
+	//~ End ULiveLinkRole interface
+};
@@ -255,4 +255,73 @@ struct MAYALIVELINKINTERFACE_API FMayaLiveLinkAnimSequenceFrameData : public FMa
 
 	UPROPERTY()
 	TArray<FMayaLiveLinkAnimSequenceFrame> Frames;
+
+	// Long bakes are sent in chunks of frames, the last chunk finalizes the sequence
+	UPROPERTY()
+	bool bFinalChunk = true;
+};
+
+/**
+* Dynamic data for AnimSequence purposes, stored track-major.
+* Each channel is held in a single contiguous array indexed [Bone * NumFrames + Frame] or [Curve * NumFrames + Frame].
+*/
+USTRUCT()
+struct MAYALIVELINKINTERFACE_API FMayaLiveLinkAnimSequenceTrackFrameData : public FMayaLiveLinkAnimCurveData
+{
+	GENERATED_BODY()
+
+public:
+	// Allocate the channel arrays for the given number of frames, bones and curves
+	void Initialize(int32 InStartFrame, int32 InNumFrames, int32 InNumBones, int32 InNumCurves)
+	{
+		StartFrame = InStartFrame;
+		NumFrames = InNumFrames;
+		NumBones = InNumBones;
+		NumCurves = InNumCurves;
+		Locations.Init(FVector::ZeroVector, NumBones * NumFrames);
+		Rotations.Init(FQuat::Identity, NumBones * NumFrames);
+		Scales.Init(FVector::OneVector, NumBones * NumFrames);
+		CurveValues.Init(0.0f, NumCurves * NumFrames);
+	}
+
+	// Index of a frame in the channel arrays for the given bone or curve track
+	int32 GetIndex(int32 TrackIndex, int32 FrameIndex) const { return TrackIndex * NumFrames + FrameIndex; }
+
+	bool IsValid() const
+	{
+		return Locations.Num() == NumBones * NumFrames &&
+			   Rotations.Num() == NumBones * NumFrames &&
+			   Scales.Num() == NumBones * NumFrames &&
+			   CurveValues.Num() == NumCurves * NumFrames;
+	}
+
+public:
+	UPROPERTY()
+	int32 StartFrame = 0;
+
+	UPROPERTY()
+	int32 NumFrames = 0;
+
+	UPROPERTY()
+	int32 NumBones = 0;
+
+	UPROPERTY()
+	int32 NumCurves = 0;
+
+	UPROPERTY()
+	TArray<FVector> Locations;
+
+	UPROPERTY()
+	TArray<FQuat> Rotations;
+
+	UPROPERTY()
+	TArray<FVector> Scales;
+
+	// Blendshape/custom attribute values
+	UPROPERTY()
+	TArray<float> CurveValues;
+
+	// Long bakes are sent in chunks of frames, the last chunk finalizes the sequence
+	UPROPERTY()
+	bool bFinalChunk = true;
 };
@@ -57,24 +57,33 @@ namespace
 		return AnimSequence.GetDataModel()->GetNumberOfFrames();
 	}
 
-	void RandomizeVector3Array(TArray<FVector3f>& VecArray)
+	void PrepareUnbakedCurves(const TMap<FString, FMayaLiveLinkCurve>& Curves,
+							  TArray<FMayaLiveLinkAnimSequencePreparedData::FCurveTrack>& CurveTracks)
 	{
-		for (auto& k : VecArray)
+		CurveTracks.Reserve(Curves.Num());
+		for (auto& CurvePair : Curves)
 		{
-			k.X = FMath::FRand();
-			k.Y = FMath::FRand();
-			k.Z = FMath::FRand();
-		}
-	}
+			const FMayaLiveLinkCurve& Curve = CurvePair.Value;
 
-	void RandomizeQuaternionArray(TArray<FQuat4f>& QuatArray)
-	{
-		for (auto& k : QuatArray)
-		{
-			k.X = FMath::FRand();
-			k.Y = FMath::FRand();
-			k.Z = FMath::FRand();
-			k.W = FMath::FRand();
+			auto& CurveTrack = CurveTracks.AddDefaulted_GetRef();
+			CurveTrack.CurveName = FName(*CurvePair.Key);
+			CurveTrack.Keys.Reserve(Curve.KeyFrames.Num());
+
+			for (const auto& KeyPair : Curve.KeyFrames)
+			{
+				const auto& Value = KeyPair.Value;
+				FRichCurveKey CurveKey;
+				CurveKey.Time = KeyPair.Key;
+				CurveKey.Value = Value.Value;
+				CurveKey.ArriveTangent = FMath::RadiansToDegrees(Value.TangentAngleIn) * 0.5f;
+				CurveKey.ArriveTangentWeight = Value.TangentWeightIn;
+				CurveKey.LeaveTangent = FMath::RadiansToDegrees(Value.TangentAngleOut) * 0.5f;
+				CurveKey.LeaveTangentWeight = Value.TangentWeightOut;
+				CurveKey.InterpMode = static_cast<ERichCurveInterpMode>(Value.InterpMode.GetValue());
+				CurveKey.TangentMode = static_cast<ERichCurveTangentMode>(Value.TangentMode.GetValue());
+				CurveKey.TangentWeightMode = static_cast<ERichCurveTangentWeightMode>(Value.TangentWeightMode.GetValue());
+				CurveTrack.Keys.Emplace(MoveTemp(CurveKey));
+			}
 		}
 	}
 }
@@ -87,6 +96,8 @@ void UMayaLiveLinkAnimSequenceHelper::PushStaticDataToAnimSequence(const FMayaLi
 																   TArray<FName>& BoneTrackRemapping,
 																   FString& AnimSequenceName)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UMayaLiveLinkAnimSequenceHelper::PushStaticDataToAnimSequence);
+
 	if (StaticData.LinkedAssetPath.IsEmpty() ||
 		StaticData.SequencePath.IsEmpty() ||
 		StaticData.SequenceName.IsEmpty() ||
@@ -166,121 +177,232 @@ void UMayaLiveLinkAnimSequenceHelper::PushStaticDataToAnimSequence(const FMayaLi
 			BoneTrackRemapping.Reserve(StaticData.BoneNames.Num());
 			auto& RefSkeleton = Skeleton->GetReferenceSkeleton();
 
+			// Keys of the new bone tracks, sized to the sequence and filled with the real data once it's received
+			FRawAnimSequenceTrack EmptyTrack;
+			bool bEmptyTrackInitialized = false;
+
 			for (auto& BoneName : StaticData.BoneNames)
 			{
-				if (RefSkeleton.FindBoneIndex(BoneName) != INDEX_NONE)
+				// Existing tracks are already resized to the number of frames of the sequence by the data model
+				if (RefSkeleton.FindBoneIndex(BoneName) != INDEX_NONE &&
+					!AnimSequence->GetDataModel()->IsValidBoneTrackName(BoneName))
 				{
-					bool bValidBone = AnimSequence->GetDataModel()->IsValidBoneTrackName(BoneName);
+					if (!Controller.AddBoneCurve(BoneName, false))
+					{
+						continue;
+					}
 
-					if (!bValidBone)
+					if (!bEmptyTrackInitialized)
 					{
-						FRawAnimSequenceTrack RawTrack;
-						RawTrack.PosKeys.Init(FVector3f::ZeroVector, NumberOfFrames);
-						RawTrack.RotKeys.Init(FQuat4f::Identity, NumberOfFrames);
-						RawTrack.ScaleKeys.Init(FVector3f::OneVector, NumberOfFrames);
-
-						// NOTE: When we call SetBoneTrackKeys below, we are populating it with uniform "Identity" data for all
-						//       keys. Unreal is detecting that the data is uniform and is optimizing it to a single DefaultValue
-						//		 internally. This is fine in principle. However, there is a bug in Unreal 5.2 and 5.3 (and possibly 
-						//       earlier) that prevents this DefaultValue flag/optimization to be cleared when we later populate
-						//       the bone track with "real" (non-uniform) data, when we start receiving values from Maya. Epic are
+						EmptyTrack.PosKeys.Init(FVector3f::ZeroVector, NumberOfFrames);
+						EmptyTrack.RotKeys.Init(FQuat4f::Identity, NumberOfFrames);
+						EmptyTrack.ScaleKeys.Init(FVector3f::OneVector, NumberOfFrames);
+
+						// NOTE: Unreal detects uniform bone track keys and optimizes them to a single DefaultValue internally.
+						//       There is a bug in Unreal 5.2 and 5.3 (and possibly earlier) that prevents this optimization to be
+						//       cleared when the track is later populated with the non-uniform data received from Maya. Epic are
 						//       aware of this bug and a fix will likely make it into a later version of Unreal.
-						// 
-						//		 To avoid the optimization from kicking in in the first place, we are randomizing the initial data,
-						//		 so it no longer looks uniform. Since we'll be replacing it all with messages received from Maya,
-						//		 anyway, this is fine for the time being.
-						//       
-						RandomizeVector3Array(RawTrack.PosKeys);
-						RandomizeQuaternionArray(RawTrack.RotKeys);
-						RandomizeVector3Array(RawTrack.ScaleKeys);
-
-						bValidBone = Controller.AddBoneCurve(BoneName, false);
-						if (bValidBone)
+						//
+						//       The optimization is done per channel, so the last key of each channel is offset instead of
+						//       randomizing every key. With a single frame, that key differs from the channel's default value.
+						//       The offset is larger than the tolerance used to compare the keys, and the keys are overwritten
+						//       with the data received from Maya anyway.
+						//
+						//       The keys must still cover the whole sequence since the frame data only updates ranges of keys.
+						if (NumberOfFrames > 0)
 						{
-							Controller.SetBoneTrackKeys(BoneName, RawTrack.PosKeys, RawTrack.RotKeys, RawTrack.ScaleKeys, false);
+							constexpr float KeyOffset = 0.01f;
+							EmptyTrack.PosKeys.Last().X += KeyOffset;
+							EmptyTrack.RotKeys.Last() = FQuat4f(FVector3f::XAxisVector, KeyOffset);
+							EmptyTrack.ScaleKeys.Last().X += KeyOffset;
 						}
-						else
-						{
-							continue;
-						}
-					}
-
-					FRawAnimSequenceTrack RawTrack;
-					bool ResizeSequenceRequested = false;
-					if (NumberOfFrames != RawTrack.PosKeys.Num())
-					{
-						ResizeSequenceRequested = true;
-						RawTrack.PosKeys.Init(FVector3f::ZeroVector, NumberOfFrames);
-						// NOTE: See comment above for an explanation of why this is needed
-						RandomizeVector3Array(RawTrack.PosKeys);
-					}
-					if (NumberOfFrames != RawTrack.RotKeys.Num())
-					{
-						ResizeSequenceRequested = true;
-						RawTrack.RotKeys.Init(FQuat4f::Identity, NumberOfFrames);
-						// NOTE: See comment above for an explanation of why this is needed
-						RandomizeQuaternionArray(RawTrack.RotKeys);
-					}
-					if (NumberOfFrames != RawTrack.ScaleKeys.Num())
-					{
-						ResizeSequenceRequested = true;
-						RawTrack.ScaleKeys.Init(FVector3f::OneVector, NumberOfFrames);
-						// NOTE: See comment above for an explanation of why this is needed
-						RandomizeVector3Array(RawTrack.ScaleKeys);
+						bEmptyTrackInitialized = true;
 					}
 
-					if (ResizeSequenceRequested)
-					{
-						Controller.SetBoneTrackKeys(BoneName, RawTrack.PosKeys, RawTrack.RotKeys, RawTrack.ScaleKeys, false);
-					}
+					Controller.SetBoneTrackKeys(BoneName, EmptyTrack.PosKeys, EmptyTrack.RotKeys, EmptyTrack.ScaleKeys, false);
 				}
 				BoneTrackRemapping.Add(BoneName);
 			}
 
-			// Go through each named curve and set its keys
+			// Make sure each named curve exists, its keys are set when the frame data is received
 			for (auto& PropertyName : StaticData.PropertyNames)
 			{
-				const FString& CurveName = PropertyName.ToString();
+				FAnimationCurveIdentifier CurveId(PropertyName, ERawCurveTrackTypes::RCT_Float);
+				if (!Controller.GetModel()->FindCurve(CurveId))
+				{
+					Controller.AddCurve(CurveId, EAnimAssetCurveFlags::AACF_Editable, false);
+				}
+			}
+		}
 
-				FName CurveFName(*CurveName);
+		Controller.CloseBracket(false);
+	}
 
-				FAnimationCurveIdentifier CurveId(CurveFName, ERawCurveTrackTypes::RCT_Float);
-				TArray<FRichCurveKey> RichCurveKeys;
+	AnimSequenceName = AnimSequence->GetName();
+}
 
-				const FAnimCurveBase* RichCurve = Controller.GetModel()->FindCurve(CurveId);
-				if (!RichCurve)
-					Controller.AddCurve(CurveId, EAnimAssetCurveFlags::AACF_Editable, false);
+void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiveLinkAnimSequenceFrameData& FrameData,
+																  const FMayaLiveLinkAnimSequenceParams& TimelineParams)
+{
+	FMayaLiveLinkAnimSequencePreparedData PreparedData;
+	PrepareFrameDataForAnimSequence(FrameData, TimelineParams, PreparedData);
+	CommitFrameDataToAnimSequence(PreparedData, TimelineParams);
+}
 
-				FRichCurveKey defaultCurveKey(0.0f, 0.0f);
-				RichCurveKeys.Init(defaultCurveKey, NumberOfFrames);
+void UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence(const FMayaLiveLinkAnimSequenceFrameData& FrameData,
+																	  const FMayaLiveLinkAnimSequenceParams& TimelineParams,
+																	  FMayaLiveLinkAnimSequencePreparedData& PreparedData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence);
+
+	PreparedData.StartFrame = FrameData.StartFrame;
+	PreparedData.NumberOfFrames = FrameData.Frames.Num();
+	PreparedData.bFinalChunk = FrameData.bFinalChunk;
+
+	// Transpose the frames into a track per bone
+	const int32 NumberOfBones = FrameData.Frames.Num() > 0 ? FMath::Min(FrameData.Frames[0].Locations.Num(), TimelineParams.BoneTrackRemapping.Num()) : 0;
+	TArray<int32> BoneTrackIndices;
+	BoneTrackIndices.Init(INDEX_NONE, NumberOfBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumberOfBones; ++BoneIndex)
+	{
+		const FName& TrackName = TimelineParams.BoneTrackRemapping[BoneIndex];
+		if (!TrackName.IsValid())
+		{
+			continue;
+		}
+
+		BoneTrackIndices[BoneIndex] = PreparedData.BoneTracks.Num();
+		auto& BoneTrack = PreparedData.BoneTracks.AddDefaulted_GetRef();
+		BoneTrack.BoneName = TrackName;
+		BoneTrack.Locations.Init(FVector::ZeroVector, FrameData.Frames.Num());
+		BoneTrack.Rotations.Init(FQuat::Identity, FrameData.Frames.Num());
+		BoneTrack.Scales.Init(FVector::OneVector, FrameData.Frames.Num());
+	}
 
-				const FFrameRate& FrameRate = AnimSequence->GetDataModel()->GetFrameRate();
-				const double Interval = FrameRate.AsInterval();
+	for (int32 FrameIndex = 0; FrameIndex < FrameData.Frames.Num(); ++FrameIndex)
+	{
+		auto& Frame = FrameData.Frames[FrameIndex];
 
-				// Update the times to the correct values
-				for (int i = 0; i < RichCurveKeys.Num(); ++i)
+		const int32 BoneArraySize = FMath::Min(Frame.Locations.Num(), NumberOfBones);
+		for (int32 BoneIndex = 0; BoneIndex < BoneArraySize; ++BoneIndex)
+		{
+			if (BoneTrackIndices[BoneIndex] == INDEX_NONE)
+			{
+				continue;
+			}
+
+			auto& BoneTrack = PreparedData.BoneTracks[BoneTrackIndices[BoneIndex]];
+			BoneTrack.Locations[FrameIndex] = Frame.Locations[BoneIndex];
+			BoneTrack.Rotations[FrameIndex] = Frame.Rotations[BoneIndex];
+			BoneTrack.Scales[FrameIndex] = Frame.Scales[BoneIndex];
+		}
+	}
+
+	// Unbaked curves
+	PrepareUnbakedCurves(FrameData.Curves, PreparedData.Curves);
+
+	// Animation curves (blendshape/morph target and custom attributes)
+	if (FrameData.Frames.Num() > 0 && FrameData.Frames[0].PropertyValues.Num() > 0)
+	{
+		const int32 NumberOfProperties = FMath::Min(FrameData.Frames[0].PropertyValues.Num(), TimelineParams.CurveNames.Num());
+		for (int32 PropIndex = 0; PropIndex < NumberOfProperties; ++PropIndex)
+		{
+			auto& CurveTrack = PreparedData.PropertyCurves.AddDefaulted_GetRef();
+			CurveTrack.CurveName = TimelineParams.CurveNames[PropIndex];
+			CurveTrack.Keys.Reserve(FrameData.Frames.Num());
+		}
+
+		for (int32 FrameIndex = 0; FrameIndex < FrameData.Frames.Num(); ++FrameIndex)
+		{
+			auto& Frame = FrameData.Frames[FrameIndex];
+
+			const int32 PropArraySize = FMath::Min(Frame.PropertyValues.Num(), NumberOfProperties);
+			for (int32 PropIndex = 0; PropIndex < PropArraySize; ++PropIndex)
+			{
+				if (!PreparedData.PropertyCurves[PropIndex].CurveName.IsValid())
 				{
-					auto& Key = RichCurveKeys[i];
-					Key.Time = static_cast<float>(i) * Interval;
+					continue;
 				}
 
-				Controller.SetCurveKeys(CurveId, RichCurveKeys, false);
+				FRichCurveKey CurveKey;
+				CurveKey.Time = static_cast<float>(FrameData.StartFrame + FrameIndex);
+				CurveKey.Value = Frame.PropertyValues[PropIndex];
+				CurveKey.InterpMode = ERichCurveInterpMode::RCIM_Linear;
+				PreparedData.PropertyCurves[PropIndex].Keys.Emplace(MoveTemp(CurveKey));
 			}
 		}
+	}
+}
 
-		Controller.CloseBracket(false);
+void UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence(const FMayaLiveLinkAnimSequenceTrackFrameData& FrameData,
+																	  const FMayaLiveLinkAnimSequenceParams& TimelineParams,
+																	  FMayaLiveLinkAnimSequencePreparedData& PreparedData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UMayaLiveLinkAnimSequenceHelper::PrepareFrameDataForAnimSequence);
+
+	if (!FrameData.IsValid())
+	{
+		return;
 	}
 
-	AnimSequenceName = AnimSequence->GetName();
+	PreparedData.StartFrame = FrameData.StartFrame;
+	PreparedData.NumberOfFrames = FrameData.NumFrames;
+	PreparedData.bFinalChunk = FrameData.bFinalChunk;
+
+	// The bone tracks are already contiguous, only slice them
+	const int32 NumberOfBones = FMath::Min(FrameData.NumBones, TimelineParams.BoneTrackRemapping.Num());
+	for (int32 BoneIndex = 0; BoneIndex < NumberOfBones; ++BoneIndex)
+	{
+		const FName& TrackName = TimelineParams.BoneTrackRemapping[BoneIndex];
+		if (!TrackName.IsValid())
+		{
+			continue;
+		}
+
+		const int32 Offset = FrameData.GetIndex(BoneIndex, 0);
+		auto& BoneTrack = PreparedData.BoneTracks.AddDefaulted_GetRef();
+		BoneTrack.BoneName = TrackName;
+		BoneTrack.Locations.Append(FrameData.Locations.GetData() + Offset, FrameData.NumFrames);
+		BoneTrack.Rotations.Append(FrameData.Rotations.GetData() + Offset, FrameData.NumFrames);
+		BoneTrack.Scales.Append(FrameData.Scales.GetData() + Offset, FrameData.NumFrames);
+	}
+
+	// Unbaked curves
+	PrepareUnbakedCurves(FrameData.Curves, PreparedData.Curves);
+
+	// Animation curves (blendshape/morph target and custom attributes)
+	const int32 NumberOfCurves = FMath::Min(FrameData.NumCurves, TimelineParams.CurveNames.Num());
+	for (int32 CurveIndex = 0; CurveIndex < NumberOfCurves; ++CurveIndex)
+	{
+		const FName& CurveName = TimelineParams.CurveNames[CurveIndex];
+		if (!CurveName.IsValid())
+		{
+			continue;
+		}
+
+		auto& CurveTrack = PreparedData.PropertyCurves.AddDefaulted_GetRef();
+		CurveTrack.CurveName = CurveName;
+		CurveTrack.Keys.Reserve(FrameData.NumFrames);
+		for (int32 FrameIndex = 0; FrameIndex < FrameData.NumFrames; ++FrameIndex)
+		{
+			FRichCurveKey CurveKey;
+			CurveKey.Time = static_cast<float>(FrameData.StartFrame + FrameIndex);
+			CurveKey.Value = FrameData.CurveValues[FrameData.GetIndex(CurveIndex, FrameIndex)];
+			CurveKey.InterpMode = ERichCurveInterpMode::RCIM_Linear;
+			CurveTrack.Keys.Emplace(MoveTemp(CurveKey));
+		}
+	}
 }
 
-void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiveLinkAnimSequenceFrameData& FrameData,
-																  const FMayaLiveLinkAnimSequenceParams& TimelineParams)
+void UMayaLiveLinkAnimSequenceHelper::CommitFrameDataToAnimSequence(const FMayaLiveLinkAnimSequencePreparedData& PreparedData,
+																	const FMayaLiveLinkAnimSequenceParams& TimelineParams)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UMayaLiveLinkAnimSequenceHelper::CommitFrameDataToAnimSequence);
+
 	if (TimelineParams.SequencePath.IsEmpty() ||
 		TimelineParams.SequenceName.IsEmpty() ||
-		(FrameData.Frames.IsEmpty() &&
-		 FrameData.Curves.IsEmpty()))
+		(PreparedData.NumberOfFrames == 0 &&
+		 PreparedData.Curves.IsEmpty()))
 	{
 		return;
 	}
@@ -300,62 +422,34 @@ void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiv
 	}
 
 	// Update the baked animation frame for each bone
-	bool SequenceUpdated = false;
-	TMap<FName, FMayaLiveLinkAnimSequenceFrame> FramesByBone;
 	const int32 NumberOfFrames = GetAnimSequenceNumberOfFrames(*AnimSequence);
-	for (int FrameIndex = 0; FrameIndex < FrameData.Frames.Num(); ++FrameIndex)
-	{
-		auto& Frame = FrameData.Frames[FrameIndex];
-
-		auto BoneArraySize = Frame.Locations.Num();
-		for (int32 BoneIndex = 0; BoneIndex < BoneArraySize; ++BoneIndex)
-		{
-			if (BoneIndex >= TimelineParams.BoneTrackRemapping.Num())
-			{
-				continue;
-			}
-			const FName& TrackName = TimelineParams.BoneTrackRemapping[BoneIndex];
-			if (!TrackName.IsValid())
-			{
-				continue;
-			}
-
-			if (NumberOfFrames > 0 && FrameIndex < NumberOfFrames)
-			{
-				auto BoneTrackPtr = FramesByBone.Find(TrackName);
-				if (!BoneTrackPtr)
-				{
-					BoneTrackPtr = &FramesByBone.Emplace(TrackName);
-					BoneTrackPtr->Locations.Init(FVector::ZeroVector, FrameData.Frames.Num());
-					BoneTrackPtr->Rotations.Init(FQuat::Identity, FrameData.Frames.Num());
-					BoneTrackPtr->Scales.Init(FVector::OneVector, FrameData.Frames.Num());
-				}
-
-				FMayaLiveLinkAnimSequenceFrame& BoneTrack = *BoneTrackPtr;
-				BoneTrack.Locations[FrameIndex] = Frame.Locations[BoneIndex];
-				BoneTrack.Rotations[FrameIndex] = Frame.Rotations[BoneIndex];
-				BoneTrack.Scales[FrameIndex] = Frame.Scales[BoneIndex];
-				SequenceUpdated = true;
-			}
-		}
-	}
-
-	if (SequenceUpdated)
+	int32 FirstIndex = 0;
+	int32 NumFramesInSequence = 0;
+	if (NumberOfFrames > 0 && PreparedData.BoneTracks.Num() > 0 &&
+		PreparedData.GetFramesInSequence(NumberOfFrames, FirstIndex, NumFramesInSequence))
 	{
 		UE::Anim::Compression::FScopedCompressionGuard CompressionGuard(AnimSequence);
 
 		auto& Controller = AnimSequence->GetController();
 		Controller.OpenBracket(LOCTEXT("SetBoneTrackKeys_Bracket", "Setting Bone Animation Tracks"), false);
 		{
-			for (auto& FramePair : FramesByBone)
+			const int32 FirstFrame = PreparedData.StartFrame + FirstIndex;
+			const FInt32Range FrameRange(FInt32Range::BoundsType::Inclusive(FirstFrame),
+										 FInt32Range::BoundsType::Inclusive(FirstFrame + NumFramesInSequence - 1));
+			for (const auto& BoneTrack : PreparedData.BoneTracks)
 			{
-				FName& BoneName = FramePair.Key;
-				FMayaLiveLinkAnimSequenceFrame& BoneData = FramePair.Value;
-				Controller.UpdateBoneTrackKeys(BoneName,
-											   FInt32Range(FInt32Range::BoundsType::Inclusive(FrameData.StartFrame), FInt32Range::BoundsType::Inclusive(FrameData.StartFrame + BoneData.Locations.Num() - 1)),
-											   BoneData.Locations,
-											   BoneData.Rotations,
-											   BoneData.Scales,
+				if (NumFramesInSequence == PreparedData.NumberOfFrames)
+				{
+					Controller.UpdateBoneTrackKeys(BoneTrack.BoneName, FrameRange, BoneTrack.Locations, BoneTrack.Rotations, BoneTrack.Scales, false);
+					continue;
+				}
+
+				// Only the frames of the chunk that fit in the sequence are keyed
+				Controller.UpdateBoneTrackKeys(BoneTrack.BoneName,
+											   FrameRange,
+											   TArray<FVector>(BoneTrack.Locations.GetData() + FirstIndex, NumFramesInSequence),
+											   TArray<FQuat>(BoneTrack.Rotations.GetData() + FirstIndex, NumFramesInSequence),
+											   TArray<FVector>(BoneTrack.Scales.GetData() + FirstIndex, NumFramesInSequence),
 											   false);
 			}
 		}
@@ -364,46 +458,28 @@ void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiv
 	}
 
 	// Unbaked curves
-	if (FrameData.Curves.Num() > 0)
+	if (PreparedData.Curves.Num() > 0)
 	{
 		UE::Anim::Compression::FScopedCompressionGuard CompressionGuard(AnimSequence);
 
-		FName ContainerName("AnimationCurves");
-
 		auto& Controller = AnimSequence->GetController();
 		const FFrameRate& FrameRate = AnimSequence->GetDataModel()->GetFrameRate();
 		const double Interval = FrameRate.AsInterval();
 
-		for (auto& CurvePair : FrameData.Curves)
+		TArray<FRichCurveKey> RichCurves;
+		for (const auto& CurveTrack : PreparedData.Curves)
 		{
-			const FString& CurveName = CurvePair.Key;
-			const FMayaLiveLinkCurve& Curve = CurvePair.Value;
-
-			FName CurveFName(*CurveName);
-
-			FAnimationCurveIdentifier CurveId(CurveFName, ERawCurveTrackTypes::RCT_Float);
+			FAnimationCurveIdentifier CurveId(CurveTrack.CurveName, ERawCurveTrackTypes::RCT_Float);
 			const FAnimCurveBase* RichCurve = Controller.GetModel()->FindCurve(CurveId);
 			if (!RichCurve)
 			{
 				Controller.AddCurve(CurveId, EAnimAssetCurveFlags::AACF_Editable, false);
 			}
 
-			TArray<FRichCurveKey> RichCurves;
-
-			for (const auto& KeyPair : Curve.KeyFrames)
+			RichCurves = CurveTrack.Keys;
+			for (auto& CurveKey : RichCurves)
 			{
-				const auto& Value = KeyPair.Value;
-				FRichCurveKey CurveKey;
-				CurveKey.Time = KeyPair.Key * Interval;
-				CurveKey.Value = Value.Value;
-				CurveKey.ArriveTangent = FMath::RadiansToDegrees(Value.TangentAngleIn) * 0.5f;
-				CurveKey.ArriveTangentWeight = Value.TangentWeightIn;
-				CurveKey.LeaveTangent = FMath::RadiansToDegrees(Value.TangentAngleOut) * 0.5f;
-				CurveKey.LeaveTangentWeight = Value.TangentWeightOut;
-				CurveKey.InterpMode = static_cast<ERichCurveInterpMode>(Value.InterpMode.GetValue());
-				CurveKey.TangentMode = static_cast<ERichCurveTangentMode>(Value.TangentMode.GetValue());
-				CurveKey.TangentWeightMode = static_cast<ERichCurveTangentWeightMode>(Value.TangentWeightMode.GetValue());
-				RichCurves.Emplace(MoveTemp(CurveKey));
+				CurveKey.Time *= Interval;
 			}
 
 			Controller.SetCurveKeys(CurveId, RichCurves, false);
@@ -411,7 +487,7 @@ void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiv
 	}
 
 	// Update animation curves (blendshape/morph target and custom attributes)
-	if(FrameData.Frames.Num() > 0 && FrameData.Frames[0].PropertyValues.Num() > 0)
+	if (PreparedData.PropertyCurves.Num() > 0)
 	{
 		UE::Anim::Compression::FScopedCompressionGuard CompressionGuard(AnimSequence);
 		const FFrameRate& FrameRate = AnimSequence->GetDataModel()->GetFrameRate();
@@ -421,34 +497,15 @@ void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiv
 
 		Controller.OpenBracket(LOCTEXT("SetAnimKeys_Bracket", "Setting Animation Curve Tracks"), false);
 		{
-			for (int FrameIndex = 0; FrameIndex < FrameData.Frames.Num(); ++FrameIndex)
+			for (const auto& CurveTrack : PreparedData.PropertyCurves)
 			{
-				auto& Frame = FrameData.Frames[FrameIndex];
-
-				int FrameNumber = FrameData.StartFrame + FrameIndex;
-				auto PropArraySize = Frame.PropertyValues.Num();
-				for (int32 PropIndex = 0; PropIndex < PropArraySize; ++PropIndex)
+				FAnimationCurveIdentifier CurveId(CurveTrack.CurveName, ERawCurveTrackTypes::RCT_Float);
+				for (const auto& Key : CurveTrack.Keys)
 				{
-					if (PropIndex >= TimelineParams.CurveNames.Num())
+					if (NumberOfFrames > 0 && Key.Time < NumberOfFrames)
 					{
-						continue;
-					}
-
-					const FName& CurveName = TimelineParams.CurveNames[PropIndex];
-					FAnimationCurveIdentifier CurveId(CurveName, ERawCurveTrackTypes::RCT_Float);
-
-					if (!CurveName.IsValid())
-					{
-						continue;
-					}
-
-					if (NumberOfFrames > 0 && FrameNumber < NumberOfFrames)
-					{
-						FRichCurveKey CurveKey;
-						CurveKey.Time = static_cast<float>(FrameNumber) * Interval;
-						CurveKey.Value = Frame.PropertyValues[PropIndex];
-						CurveKey.InterpMode = ERichCurveInterpMode::RCIM_Linear;
-
+						FRichCurveKey CurveKey(Key);
+						CurveKey.Time = Key.Time * Interval;
 						Controller.SetCurveKey(CurveId, CurveKey, false);
 					}
 				}
@@ -457,7 +514,11 @@ void UMayaLiveLinkAnimSequenceHelper::PushFrameDataToAnimSequence(const FMayaLiv
 		Controller.CloseBracket(false);
 	}
 
-	FMayaLiveLinkUtils::RefreshContentBrowser(*AnimSequence);
+	// Chunks are appended as they arrive, the asset is only notified once the whole bake is received
+	if (PreparedData.bFinalChunk)
+	{
+		FMayaLiveLinkUtils::NotifyAssetModified(*AnimSequence);
+	}
 }
 
 bool UMayaLiveLinkAnimSequenceHelper::StaticUpdateAnimSequence(UAnimSequence& AnimSequence,
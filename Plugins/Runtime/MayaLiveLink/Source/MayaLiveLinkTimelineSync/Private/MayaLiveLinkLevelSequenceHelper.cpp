@@ -718,7 +718,7 @@ void UMayaLiveLinkLevelSequenceHelper::PushFrameDataToLevelSequence(const FMayaL
 		}
 	}
 
-	FMayaLiveLinkUtils::RefreshContentBrowser(*LevelSequence);
+	FMayaLiveLinkUtils::NotifyAssetModified(*LevelSequence);
 }
 
 template<typename T>
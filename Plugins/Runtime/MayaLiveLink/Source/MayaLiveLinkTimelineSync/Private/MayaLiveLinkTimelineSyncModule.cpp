@@ -65,6 +65,7 @@ void FMayaLiveLinkTimelineSyncModule::StartupModule()
 	bIgnoreTimeChange = false;
 	bBlockTimeChangeFeedback = true;
 	LastFrameTime.Time.FrameNumber.Value = 0;
+	ResetPreviewTimeCache();
 
 	// Hook on when the sequencer editor is created
 	ISequencerModule& SequencerModule = FModuleManager::Get().LoadModuleChecked<ISequencerModule>(TEXT("Sequencer"));
@@ -99,7 +100,9 @@ void FMayaLiveLinkTimelineSyncModule::ShutdownModule()
 			PersonaModule->OnPreviewSceneCreated().Remove(OnPreviewSceneCreatedHandle);
 		}
 	}
-	WeakPreviewScene.Reset();
+	UnregisterPreviewScene();
+
+	FMayaLiveLinkUtils::Shutdown();
 }
 
 void FMayaLiveLinkTimelineSyncModule::OnSequencerCreated(TSharedRef<ISequencer> Sequencer)
@@ -171,7 +174,7 @@ void FMayaLiveLinkTimelineSyncModule::OnSequencerTimeChanged(TWeakPtr<ISequencer
 		FFrameNumber LastFrameNumber = AsFrameNumber(LastFrameTime.Time.AsDecimal(), LastFrameTime.Rate);
 		if (NewFrameNumber != LastFrameNumber)
 		{
-			LastFrameTime = FQualifiedFrameTime(SnappedFrameTime, NewFrameTime.Rate);
+			SetLastFrameTime(FQualifiedFrameTime(SnappedFrameTime, NewFrameTime.Rate));
 			bIgnoreTimeChange = true;
 
 			// Broadcast the time change to the Message bus source
@@ -182,14 +185,36 @@ void FMayaLiveLinkTimelineSyncModule::OnSequencerTimeChanged(TWeakPtr<ISequencer
 
 void FMayaLiveLinkTimelineSyncModule::OnAnimSequenceEditorPreviewSceneCreated(const TSharedRef<IPersonaPreviewScene>& InPreviewScene)
 {
+	UnregisterPreviewScene();
+
 	bAnimSequenceEditorTimeSync = false;
 	LastFrameTime.Time.FrameNumber = 0;
 	WeakPreviewScene = TWeakPtr<IPersonaPreviewScene>(InPreviewScene);
 
-	// Hook on when the viewport is redrawn
+	// Hook on when the previewed animation changes, its playhead can't be compared with the last one seen
+	InPreviewScene->RegisterOnAnimChanged(FOnAnimChanged::CreateRaw(this, &FMayaLiveLinkTimelineSyncModule::OnPreviewAnimChanged));
+
+	// Hook on when the viewport is redrawn.
+	// Persona has no event when its playhead moves, the redraws are the only notification and they return early when it didn't move.
 	InPreviewScene->RegisterOnInvalidateViews(FSimpleDelegate::CreateRaw(this, &FMayaLiveLinkTimelineSyncModule::HandleInvalidateViews));
 }
 
+void FMayaLiveLinkTimelineSyncModule::OnPreviewAnimChanged(UAnimationAsset* AnimAsset)
+{
+	ResetPreviewTimeCache();
+}
+
+void FMayaLiveLinkTimelineSyncModule::UnregisterPreviewScene()
+{
+	if (TSharedPtr<IPersonaPreviewScene> PreviewScene = WeakPreviewScene.Pin())
+	{
+		PreviewScene->UnregisterOnAnimChanged(this);
+		PreviewScene->UnregisterOnInvalidateViews(this);
+	}
+	WeakPreviewScene.Reset();
+	ResetPreviewTimeCache();
+}
+
 void FMayaLiveLinkTimelineSyncModule::OpenAnimEditorWindow(const FString& Path, const FString& Name) const
 {
 #if WITH_EDITOR
@@ -260,6 +285,14 @@ void FMayaLiveLinkTimelineSyncModule::HandleInvalidateViews()
 	{
 		if (UAnimPreviewInstance* PreviewInstance = PreviewMeshComp->PreviewInstance)
 		{
+			// The views are invalidated on every redraw, only do the work when the playhead moved or a time change is pending
+			const float PreviewTime = PreviewInstance->GetCurrentTime();
+			if (!bIgnoreTimeChange && PreviewTime == LastPreviewTime)
+			{
+				return;
+			}
+			LastPreviewTime = PreviewTime;
+
 			// Update the animation editor current time if receiving a time change from the sequencer
 			FQualifiedFrameTime LastFrameTimeCopy = LastFrameTime;
 			if (bIgnoreTimeChange)
@@ -322,7 +355,7 @@ void FMayaLiveLinkTimelineSyncModule::SetCurrentTime(const FQualifiedFrameTime&
 {
 	bBlockTimeChangeFeedback = true;
 
-	LastFrameTime = Time;
+	SetLastFrameTime(Time);
 
 	// Update the time in the AnimSequence editor
 	if (bAnimSequenceEditorTimeSync)
@@ -402,6 +435,23 @@ void FMayaLiveLinkTimelineSyncModule::SetSequencerTime(const FQualifiedFrameTime
 	}
 }
 
+void FMayaLiveLinkTimelineSyncModule::SetLastFrameTime(const FQualifiedFrameTime& Time)
+{
+	LastFrameTime = Time;
+
+	// The preview playhead has to be compared again with the new time
+	ResetPreviewTimeCache();
+}
+
+void FMayaLiveLinkTimelineSyncModule::EnableAnimSequenceEditorTimeSync(bool bEnable)
+{
+	if (bAnimSequenceEditorTimeSync != bEnable)
+	{
+		bAnimSequenceEditorTimeSync = bEnable;
+		ResetPreviewTimeCache();
+	}
+}
+
 void FMayaLiveLinkTimelineSyncModule::SetLastTime()
 {
 	SetCurrentTime(LastFrameTime);
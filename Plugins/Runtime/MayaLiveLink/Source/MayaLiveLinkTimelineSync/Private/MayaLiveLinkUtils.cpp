@@ -22,42 +22,153 @@
 
 #include "MayaLiveLinkUtils.h"
 
-#include "ContentBrowserModule.h"
-#include "IContentBrowserSingleton.h"
-
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
 
-void FMayaLiveLinkUtils::RefreshContentBrowser(const UObject& Object)
+namespace
 {
-	// Need to refresh the content browser if the current selected folder is the one for the LevelSequence
-	// Modifying the LevelSequence doesn't seem to show the dirty "star" flag.
-	// Do the update only once per second to avoid freezing the content browser.
-	static int32 Time = 0;
-	const int32 NewSeconds = FDateTime::Now().GetTimeOfDay().GetTotalSeconds();
-	if (NewSeconds != Time && Object.GetPackage())
-	{
-		Time = NewSeconds;
-		UPackage* Package = Object.GetPackage();
-
-		IContentBrowserSingleton& ContentBrowser = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser").Get();
-		TArray<FString> CurrentSelectedFolders;
-		ContentBrowser.GetSelectedPathViewFolders(CurrentSelectedFolders);
-		if (CurrentSelectedFolders.Num() == 1)
+	// Time without new modification after which the pending asset notifications are sent
+	constexpr double AssetNotificationQuietTime = 0.5;
+
+	// Assets found by FindAssetObject, keyed by their path and name
+	TMap<FString, TWeakObjectPtr<UObject>> FoundAssets;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+
+	void ResetFoundAssets()
+	{
+		FoundAssets.Empty();
+	}
+
+	void RegisterFoundAssetsInvalidation()
+	{
+		if (AssetRemovedHandle.IsValid())
+		{
+			return;
+		}
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData&)
+		{
+			ResetFoundAssets();
+		});
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData&, const FString&)
+		{
+			ResetFoundAssets();
+		});
+	}
+
+	TSet<TWeakObjectPtr<UObject>> PendingModifiedAssets;
+	double LastAssetModificationTime = 0.0;
+	FTSTicker::FDelegateHandle AssetNotificationTickerHandle;
+
+	bool FlushModifiedAssets(float DeltaTime)
+	{
+		if (FPlatformTime::Seconds() - LastAssetModificationTime < AssetNotificationQuietTime)
 		{
-			const FPackagePath& Path = Package->GetLoadedPath();
-			if (!Path.IsEmpty())
+			return true;
+		}
+
+		for (const TWeakObjectPtr<UObject>& WeakAsset : PendingModifiedAssets)
+		{
+			if (UObject* Asset = WeakAsset.Get())
 			{
-				const FString PackageName = FPackageName::FilenameToLongPackageName(Path.GetLocalFullPath());
-				const FString PackagePath = FPackageName::GetLongPackagePath(PackageName);
-				const int32 Index = CurrentSelectedFolders[0].Find(PackagePath);
-
-				// Make sure the end of the string is the full package path.
-				// GetSelectedPathViewFolders returns paths with some extra parent folder like "/All/".
-				if (Index > 0 && (Index + PackagePath.Len()) == CurrentSelectedFolders[0].Len())
-				{
-					ContentBrowser.SetSelectedPaths({ PackageName }, true);
-				}
+				// Show the dirty flag of the asset and let the content browser regenerate its thumbnail
+				Asset->MarkPackageDirty();
+				FPropertyChangedEvent PropertyChangedEvent(nullptr);
+				FCoreUObjectDelegates::OnObjectPropertyChanged.Broadcast(Asset, PropertyChangedEvent);
 			}
 		}
+		PendingModifiedAssets.Empty();
+
+		AssetNotificationTickerHandle.Reset();
+		return false;
+	}
+}
+
+UObject* FMayaLiveLinkUtils::FindAssetObject(const FString& Path, const FString& Name)
+{
+	if (Path.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString Key = Path + TEXT(":") + Name;
+	if (const TWeakObjectPtr<UObject>* FoundAsset = FoundAssets.Find(Key))
+	{
+		if (UObject* Asset = FoundAsset->Get())
+		{
+			return Asset;
+		}
+		FoundAssets.Remove(Key);
+	}
+
+	// If we found a package, try and get the primary asset from it
+	UObject* Asset = nullptr;
+	if (UPackage* FoundPackage = FindPackage(nullptr, *Path))
+	{
+		Asset = StaticFindObject(UObject::StaticClass(),
+								 FoundPackage,
+								 Name.IsEmpty() ?
+								 (*FPackageName::GetShortName(FoundPackage)) :
+								 (*Name));
+	}
+
+	if (Asset)
+	{
+		RegisterFoundAssetsInvalidation();
+		FoundAssets.Add(Key, Asset);
+	}
+	return Asset;
+}
+
+UObject* FMayaLiveLinkUtils::FindAssetObjectInRegistry(const FString& PackagePath, const FString& AssetName)
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	auto& AssetRegistry = AssetRegistryModule.Get();
+
+	// Query the asset directly by its object path instead of enumerating the whole folder
+	const FSoftObjectPath ObjectPath(FPaths::Combine(PackagePath, AssetName) + TEXT(".") + AssetName);
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(ObjectPath);
+	return AssetData.IsValid() ? AssetData.GetAsset() : nullptr;
+}
+
+void FMayaLiveLinkUtils::NotifyAssetModified(UObject& Object)
+{
+	// Sync keeps modifying the same assets, only notify once the streaming is quiet
+	PendingModifiedAssets.Add(&Object);
+	LastAssetModificationTime = FPlatformTime::Seconds();
+
+	if (!AssetNotificationTickerHandle.IsValid())
+	{
+		AssetNotificationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FlushModifiedAssets));
+	}
+}
+
+void FMayaLiveLinkUtils::Shutdown()
+{
+	// The pending notifications are dropped, the editor is going away with the module
+	if (AssetNotificationTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(AssetNotificationTickerHandle);
+		AssetNotificationTickerHandle.Reset();
+	}
+	PendingModifiedAssets.Empty();
+
+	// The asset registry is still loaded since this module depends on it
+	if (AssetRemovedHandle.IsValid())
+	{
+		if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+		}
+		AssetRemovedHandle.Reset();
+		AssetRenamedHandle.Reset();
 	}
+	ResetFoundAssets();
 }
@@ -0,0 +1,84 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MayaLiveLinkAnimSequenceHelper.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMayaLiveLinkAnimSequenceChunkTest,
+								 "MayaLiveLink.AnimSequence.ChunkFramesInSequence",
+								 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMayaLiveLinkAnimSequenceChunkTest::RunTest(const FString& Parameters)
+{
+	// A 300 frames bake sent in chunks of 128 frames, received out of order with the short final chunk first
+	const int32 NumberOfSequenceFrames = 300;
+	const int32 ChunkStartFrames[] = { 256, 0, 128 };
+
+	TArray<int32> KeysPerFrame;
+	KeysPerFrame.Init(0, NumberOfSequenceFrames);
+	for (const int32 StartFrame : ChunkStartFrames)
+	{
+		FMayaLiveLinkAnimSequencePreparedData Chunk;
+		Chunk.StartFrame = StartFrame;
+		Chunk.NumberOfFrames = FMath::Min(128, NumberOfSequenceFrames - StartFrame);
+		Chunk.bFinalChunk = StartFrame == 256;
+
+		int32 FirstIndex = 0;
+		int32 NumFramesInSequence = 0;
+		if (TestTrue(TEXT("The chunk is in the sequence"), Chunk.GetFramesInSequence(NumberOfSequenceFrames, FirstIndex, NumFramesInSequence)))
+		{
+			TestEqual(TEXT("Every frame of the chunk is keyed"), NumFramesInSequence, Chunk.NumberOfFrames);
+			for (int32 FrameIndex = FirstIndex; FrameIndex < FirstIndex + NumFramesInSequence; ++FrameIndex)
+			{
+				++KeysPerFrame[Chunk.StartFrame + FrameIndex];
+			}
+		}
+	}
+
+	for (int32 Frame = 0; Frame < NumberOfSequenceFrames; ++Frame)
+	{
+		TestEqual(FString::Printf(TEXT("Frame %d is keyed once"), Frame), KeysPerFrame[Frame], 1);
+	}
+
+	// The sequence was shortened, only the start of the last full chunk is keyed
+	{
+		FMayaLiveLinkAnimSequencePreparedData Chunk;
+		Chunk.StartFrame = 256;
+		Chunk.NumberOfFrames = 128;
+
+		int32 FirstIndex = 0;
+		int32 NumFramesInSequence = 0;
+		TestTrue(TEXT("The chunk overlaps the sequence"), Chunk.GetFramesInSequence(NumberOfSequenceFrames, FirstIndex, NumFramesInSequence));
+		TestEqual(TEXT("The chunk is keyed from its start"), FirstIndex, 0);
+		TestEqual(TEXT("The chunk is truncated at the end of the sequence"), NumFramesInSequence, NumberOfSequenceFrames - 256);
+
+		Chunk.StartFrame = NumberOfSequenceFrames;
+		TestFalse(TEXT("A chunk past the end of the sequence is skipped"), Chunk.GetFramesInSequence(NumberOfSequenceFrames, FirstIndex, NumFramesInSequence));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
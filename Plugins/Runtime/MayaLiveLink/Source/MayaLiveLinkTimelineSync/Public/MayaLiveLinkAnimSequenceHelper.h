@@ -25,10 +25,51 @@
 #include "CoreMinimal.h"
 
 #include "Animation/Skeleton.h"
+#include "Curves/RichCurve.h"
 #include "UObject/ObjectMacros.h"
 
 #include "MayaLiveLinkAnimSequenceHelper.generated.h"
 
+// Anim sequence frame data rearranged into per-track key arrays.
+// It can be built on any thread and only needs to be committed to the anim sequence on the game thread.
+// Curve key times are expressed in frames and converted to seconds when committed.
+struct FMayaLiveLinkAnimSequencePreparedData
+{
+	struct FBoneTrack
+	{
+		FName BoneName;
+		TArray<FVector> Locations;
+		TArray<FQuat> Rotations;
+		TArray<FVector> Scales;
+	};
+
+	struct FCurveTrack
+	{
+		FName CurveName;
+		TArray<FRichCurveKey> Keys;
+	};
+
+	int32 StartFrame = 0;
+	int32 NumberOfFrames = 0;
+	bool bFinalChunk = true;
+	TArray<FBoneTrack> BoneTracks;
+
+	// Unbaked curves, their keys replace the existing keys
+	TArray<FCurveTrack> Curves;
+
+	// Baked blendshape/custom attribute curves, one key per frame
+	TArray<FCurveTrack> PropertyCurves;
+
+	// Get the frames of the chunk that fall in a sequence of NumberOfSequenceFrames frames,
+	// the chunk starts at StartFrame in the sequence. Returns false when none of them does.
+	bool GetFramesInSequence(int32 NumberOfSequenceFrames, int32& FirstIndex, int32& NumFramesInSequence) const
+	{
+		FirstIndex = FMath::Max(0, -StartFrame);
+		NumFramesInSequence = FMath::Min(NumberOfFrames, NumberOfSequenceFrames - StartFrame) - FirstIndex;
+		return NumFramesInSequence > 0;
+	}
+};
+
 UCLASS(HideCategories=Object)
 class UMayaLiveLinkAnimSequenceHelper : public UObject
 {
@@ -40,6 +81,17 @@ class UMayaLiveLinkAnimSequenceHelper : public UObject
 	static MAYALIVELINKTIMELINESYNC_API void PushFrameDataToAnimSequence(const struct FMayaLiveLinkAnimSequenceFrameData& FrameData,
 																		 const struct FMayaLiveLinkAnimSequenceParams& TimelineParams);
 
+	// Thread safe, doesn't access any UObject
+	static MAYALIVELINKTIMELINESYNC_API void PrepareFrameDataForAnimSequence(const struct FMayaLiveLinkAnimSequenceFrameData& FrameData,
+																			 const struct FMayaLiveLinkAnimSequenceParams& TimelineParams,
+																			 FMayaLiveLinkAnimSequencePreparedData& PreparedData);
+	static MAYALIVELINKTIMELINESYNC_API void PrepareFrameDataForAnimSequence(const struct FMayaLiveLinkAnimSequenceTrackFrameData& FrameData,
+																			 const struct FMayaLiveLinkAnimSequenceParams& TimelineParams,
+																			 FMayaLiveLinkAnimSequencePreparedData& PreparedData);
+	// Must be called on the game thread
+	static MAYALIVELINKTIMELINESYNC_API void CommitFrameDataToAnimSequence(const FMayaLiveLinkAnimSequencePreparedData& PreparedData,
+																		   const struct FMayaLiveLinkAnimSequenceParams& TimelineParams);
+
 private:
 	static bool StaticUpdateAnimSequence(class UAnimSequence& AnimSequence,
 										 USkeleton* Skeleton,
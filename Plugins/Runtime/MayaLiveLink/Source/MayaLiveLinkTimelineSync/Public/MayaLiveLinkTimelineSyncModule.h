@@ -61,7 +61,7 @@ public:
 
 	MAYALIVELINKTIMELINESYNC_API void SetLastTime();
 
-	MAYALIVELINKTIMELINESYNC_API void EnableAnimSequenceEditorTimeSync(bool bEnable) { bAnimSequenceEditorTimeSync = bEnable; }
+	MAYALIVELINKTIMELINESYNC_API void EnableAnimSequenceEditorTimeSync(bool bEnable);
 
 	MAYALIVELINKTIMELINESYNC_API FOnTimeChanged& GetOnTimeChangedDelegate() { return OnTimeChangedDelegate; }
 
@@ -80,11 +80,16 @@ private:
 
 	// Animation editor events
 	void OnAnimSequenceEditorPreviewSceneCreated(const TSharedRef<class IPersonaPreviewScene>& InPreviewScene);
+	void OnPreviewAnimChanged(class UAnimationAsset* AnimAsset);
 	void HandleInvalidateViews();
+	void UnregisterPreviewScene();
 
 	void SetAnimSequenceEditorTime(const FQualifiedFrameTime& Time, class UAnimPreviewInstance* PreviewAnimInstance = nullptr);
 	void SetSequencerTime(const FQualifiedFrameTime& Time);
 
+	void SetLastFrameTime(const FQualifiedFrameTime& Time);
+	void ResetPreviewTimeCache() { LastPreviewTime = -1.0f; }
+
 private:
 	// Sequencer
 	FDelegateHandle OnSequencerCreatedHandle;
@@ -99,6 +104,9 @@ private:
 	FDelegateHandle OnPreviewSceneCreatedHandle;
 	TWeakPtr<IPersonaPreviewScene> WeakPreviewScene;
 	bool bAnimSequenceEditorTimeSync;
+	// Last preview position seen when the views were invalidated, to skip the redraws that don't move the playhead.
+	// It is reset when the previewed asset, the sync or the last frame time changes.
+	float LastPreviewTime;
 
 	FOnTimeChanged OnTimeChangedDelegate;
 	bool bIgnoreTimeChange;
@@ -35,50 +35,29 @@ DEFINE_LOG_CATEGORY_STATIC(LogMayaLiveLink, Log, All);
 
 namespace FMayaLiveLinkUtils
 {
+	// Find a loaded asset, the result is memoised until an asset is renamed or removed
+	MAYALIVELINKTIMELINESYNC_API UObject* FindAssetObject(const FString& Path, const FString& Name = FString());
+
+	// Find an asset from its object path in the asset registry and load it
+	MAYALIVELINKTIMELINESYNC_API UObject* FindAssetObjectInRegistry(const FString& PackagePath, const FString& AssetName);
+
 	template<typename T>
 	T* FindAsset(const FString& Path, const FString& Name = FString())
 	{
-		if (Path.IsEmpty())
-		{
-			return nullptr;
-		}
-
-		// If we found a package, try and get the primary asset from it
-		if (UPackage* FoundPackage = FindPackage(nullptr, *Path))
-		{
-			if (auto PotentialAsset = StaticFindObject(UObject::StaticClass(),
-													   FoundPackage,
-													   Name.IsEmpty() ?
-													   (*FPackageName::GetShortName(FoundPackage)) :
-													   (*Name)))
-			{
-				return Cast<T>(PotentialAsset);
-			}
-		}
-
-		return nullptr;
+		return Cast<T>(FindAssetObject(Path, Name));
 	}
 
 	template<typename T>
 	T* FindAssetInRegistry(const FString& PackagePath, const FString& AssetName)
 	{
-		TArray<FAssetData> OutAssetData;
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-		auto& AssetRegistry = AssetRegistryModule.Get();
-
-		// Find the asset by its name and package path
-		AssetRegistry.GetAssetsByPath(FName(PackagePath), OutAssetData);
-		for (auto& Asset : OutAssetData)
-		{
-			if (Asset.AssetName.ToString() == AssetName)
-			{
-				return Cast<T>(Asset.GetAsset());
-			}
-		}
-		return nullptr;
+		return Cast<T>(FindAssetObjectInRegistry(PackagePath, AssetName));
 	}
 
-	void RefreshContentBrowser(const UObject& Object);
+	// Batch the modification notifications of an asset until the streaming is quiet
+	void NotifyAssetModified(UObject& Object);
+
+	// Remove the ticker and the delegates registered by the helpers, called when the module shuts down
+	void Shutdown();
 
 	template<typename T>
 	T* FindObject(const FString& ObjectName)
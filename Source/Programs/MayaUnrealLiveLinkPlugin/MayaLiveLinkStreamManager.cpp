@@ -23,10 +23,14 @@
 #include "MayaLiveLinkStreamManager.h"
 #include "MayaUnrealLiveLinkUtils.h"
 #include "Subjects/MLiveLinkActiveCamera.h"
+#include "Subjects/MSceneDeformerIndex.h"
 
 #include "UnrealInitializer/FUnrealStreamManager.h"
 
 #include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
 
 //! Unreal Includes
 #include "LiveLinkTypes.h"
@@ -36,9 +40,12 @@
 
 THIRD_PARTY_INCLUDES_START
 #include <maya/MAnimControl.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MGlobal.h>
 #include <maya/MItDag.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MSelectionList.h>
 THIRD_PARTY_INCLUDES_END
 
@@ -52,6 +59,11 @@ MayaLiveLinkStreamManager::MayaLiveLinkStreamManager()
 { 
 	StreamedSubjects.clear();
 	AnimSequenceStreamingPaused = false;
+	StreamBudgetMs = 0.0;
+	NextRoundRobinIndex = 0;
+	bSelectedSubjectsDirty = true;
+	PlaybackLookAhead = 0;
+	bLookAheadStarted = false;
 }
 
 //======================================================================
@@ -325,6 +337,7 @@ bool  MayaLiveLinkStreamManager::AddSubjectOfType(int Index, ArgsType&&... Args)
 		StreamedSubjects.insert(StreamedSubjects.begin() + Index, Subject);
 	else
 		StreamedSubjects.emplace_back(Subject);
+	InvalidateSelectedSubjects();
 
 	return RebuildSubjectStatus;
 }
@@ -467,6 +480,42 @@ void MayaLiveLinkStreamManager::GetSubjectTypes(MStringArray& Entries) const
 	}
 }
 
+//======================================================================
+//
+/*!	\brief	Get the number of Maya callbacks and their registration time per subject role.
+
+	\param[in] Entries Reference to string array to store one "role subjects callbacks registrationMs" entry per role
+
+*/
+void MayaLiveLinkStreamManager::GetSubjectCallbackStats(MStringArray& Entries) const
+{
+	struct FCallbackStats
+	{
+		unsigned int NumSubjects = 0;
+		unsigned int NumCallbacks = 0;
+		double RegistrationSeconds = 0.0;
+	};
+	std::map<std::string, FCallbackStats> StatsByRole;
+	for (const auto& Subject : StreamedSubjects)
+	{
+		auto& Stats = StatsByRole[Subject->GetRoleDisplayText().asChar()];
+		++Stats.NumSubjects;
+		Stats.NumCallbacks += Subject->GetNumCallbacks();
+		Stats.RegistrationSeconds += Subject->GetCallbackRegistrationSeconds();
+	}
+
+	for (const auto& RoleStats : StatsByRole)
+	{
+		MString Entry;
+		Entry.format("^1s ^2s ^3s ^4s",
+					 RoleStats.first.c_str(),
+					 MString() + static_cast<double>(RoleStats.second.NumSubjects),
+					 MString() + static_cast<double>(RoleStats.second.NumCallbacks),
+					 MString() + RoleStats.second.RegistrationSeconds * 1000.0);
+		Entries.append(Entry);
+	}
+}
+
 //======================================================================
 //
 /*!	\brief	Get all the subject's linked assets
@@ -612,7 +661,7 @@ int MayaLiveLinkStreamManager::RemoveSubject(const MString& PathOfSubjectToRemov
 */
 void MayaLiveLinkStreamManager::RemoveSubjectFromLiveLink(const MString& SubjectName)
 {
-	FUnrealStreamManager::TheOne().GetLiveLinkProvider()->RemoveSubject(SubjectName.asChar());
+	FUnrealStreamManager::TheOne().RemoveSubject(SubjectName.asChar());
 }
 
 //======================================================================
@@ -628,8 +677,14 @@ void MayaLiveLinkStreamManager::RemoveSubjectFromLiveLink(const MString& Subject
 bool MayaLiveLinkStreamManager::ChangeSubjectName(const MString& SubjectDagPath, const MString& NewName)
 {
 	// Check if the subject exists with this path name
-	if (nullptr != GetSubjectByDagPath(SubjectDagPath))
+	if (IMStreamedEntity* Subject = GetSubjectByDagPath(SubjectDagPath))
 	{
+		// Keep the streaming mask and schedule so that they survive the renaming
+		MStringArray ExcludedJoints;
+		MStringArray ExcludedCurves;
+		Subject->GetStreamMask(ExcludedJoints, ExcludedCurves);
+		const IMStreamedEntity::StreamScheduleInfo Schedule = Subject->GetStreamSchedule();
+
 		// Remove the subject from the subject list in Unreal Stream Manager
 		int StreamType   = GetStreamTypeByDagPath(SubjectDagPath);
 		int SubjectIndex = RemoveSubject(SubjectDagPath);
@@ -646,8 +701,15 @@ bool MayaLiveLinkStreamManager::ChangeSubjectName(const MString& SubjectDagPath,
 			MItDag DagIterator;
 			MStatus Status = DagIterator.reset(DagPath.node());
 			
-			if (MStatus::kSuccess == Status)
-				return AddSubject(DagIterator, NewName, StreamType, SubjectIndex);
+			if (MStatus::kSuccess == Status && AddSubject(DagIterator, NewName, StreamType, SubjectIndex))
+			{
+				if (ExcludedJoints.length() != 0 || ExcludedCurves.length() != 0)
+				{
+					SetSubjectStreamMask(SubjectDagPath, ExcludedJoints, ExcludedCurves);
+				}
+				SetSubjectStreamSchedule(SubjectDagPath, Schedule.TargetRate, Schedule.bHighPriority);
+				return true;
+			}
 		}
 	}
 
@@ -712,6 +774,60 @@ void MayaLiveLinkStreamManager::UnbakeUnrealAsset(const MString& SubjectPathIn)
 	}
 }
 
+//======================================================================
+//
+/*!	\brief	Set the streaming mask of a subject
+
+\param[in] SubjectPathIn     DAG path for the subject.
+\param[in] ExcludedJoints    Joints whose sub-tree will not be streamed.
+\param[in] ExcludedCurves    Curves or blend shape nodes whose weights will not be streamed.
+*/
+void MayaLiveLinkStreamManager::SetSubjectStreamMask(const MString& SubjectPathIn,
+													 const MStringArray& ExcludedJoints,
+													 const MStringArray& ExcludedCurves)
+{
+	if (auto Subject = GetSubjectByDagPath(SubjectPathIn))
+	{
+		Subject->SetStreamMask(ExcludedJoints, ExcludedCurves);
+	}
+}
+
+//======================================================================
+//
+/*!	\brief	Get the streaming mask of a subject
+
+\param[in] SubjectPathIn     DAG path for the subject.
+\param[out] ExcludedJoints   Joints whose sub-tree is not streamed.
+\param[out] ExcludedCurves   Curves or blend shape nodes whose weights are not streamed.
+
+\return True if the subject was found.
+*/
+bool MayaLiveLinkStreamManager::GetSubjectStreamMask(const MString& SubjectPathIn,
+													 MStringArray& ExcludedJoints,
+													 MStringArray& ExcludedCurves) const
+{
+	if (auto Subject = GetSubjectByDagPath(SubjectPathIn))
+	{
+		Subject->GetStreamMask(ExcludedJoints, ExcludedCurves);
+		return true;
+	}
+	return false;
+}
+
+//======================================================================
+//
+/*!	\brief	Check if joints or curves can be left out of the stream of a subject
+
+\param[in] SubjectPathIn     DAG path for the subject.
+
+\return True if the subject was found and supports a streaming mask.
+*/
+bool MayaLiveLinkStreamManager::SubjectSupportsStreamMask(const MString& SubjectPathIn) const
+{
+	auto Subject = GetSubjectByDagPath(SubjectPathIn);
+	return Subject && Subject->SupportsStreamMask();
+}
+
 //======================================================================
 //
 /*!	\brief	Update the progress bar UI
@@ -790,32 +906,6 @@ IMStreamedEntity* MayaLiveLinkStreamManager::GetSubjectByDagPath(const MDagPath&
 	return nullptr;
 }
 
-//======================================================================
-//
-/*!	\brief	Get the subjects under a common parent path.
-
-	\param[in] Parent DAG path.
-
-	\param[out] List of subjects under the DAG path.
-
-*/
-void MayaLiveLinkStreamManager::GetSubjectsFromParentPath(const MDagPath& Path, std::vector<IMStreamedEntity*>& Subjects) const
-{
-	MStatus Status;
-	MFnDagNode ParentDagNode(Path, &Status);
-	for (const std::shared_ptr<IMStreamedEntity>& Subject : StreamedSubjects)
-	{
-		if (Subject->ShouldDisplayInUI())
-		{
-			MObject Node = Subject->GetDagPath().node();
-			if (ParentDagNode.isParentOf(Node))
-			{
-				Subjects.push_back(Subject.get());
-			}
-		}
-	}
-}
-
 //======================================================================
 //
 /*!	\brief	Get a subject as IMStreamedEntity given a blendshape name owned by this subject.
@@ -939,13 +1029,69 @@ void MayaLiveLinkStreamManager::ValidateSubjects(bool NeedToRefreshUI)
 */
 void MayaLiveLinkStreamManager::RebuildSubjects(bool NeedToRefreshUI, bool ForceRelink)
 {
+	RestartPlaybackLookAhead();
 	ValidateSubjects(NeedToRefreshUI);
+	BakedRangeStart = MAnimControl::minTime();
+	BakedRangeEnd = MAnimControl::maxTime();
+
+	// Index the scene deformers once for all the subjects
+	MSceneDeformerIndex::TheOne().Rebuild();
 	for (const auto& Subject : StreamedSubjects)
 	{
 		Subject->RebuildSubjectData(ForceRelink);
 	}
 }
 
+//======================================================================
+//
+/*!	\brief	Rebuild the linked subjects if the playback range changed since they were baked.
+			The other subjects don't depend on the playback range.
+
+	\return	True if at least one subject was rebuilt.
+*/
+bool MayaLiveLinkStreamManager::RebuildLinkedSubjects()
+{
+	const MTime RangeStart = MAnimControl::minTime();
+	const MTime RangeEnd = MAnimControl::maxTime();
+	if (RangeStart == BakedRangeStart && RangeEnd == BakedRangeEnd)
+	{
+		return false;
+	}
+	BakedRangeStart = RangeStart;
+	BakedRangeEnd = RangeEnd;
+
+	ValidateSubjects(false);
+	MSceneDeformerIndex::TheOne().Rebuild();
+	bool bRebuilt = false;
+	for (const auto& Subject : StreamedSubjects)
+	{
+		if (Subject->IsLinked())
+		{
+			Subject->RebuildSubjectData(true);
+			bRebuilt = true;
+		}
+	}
+	return bRebuilt;
+}
+
+//======================================================================
+//
+/*!	\brief	Stream the linked subjects to LL provider, regardless of their scheduling.
+*/
+void MayaLiveLinkStreamManager::StreamLinkedSubjects()
+{
+	const double StreamTime = FPlatformTime::Seconds();
+	const auto FrameNumber = MAnimControl::currentTime().value();
+	for (const auto& Subject : StreamedSubjects)
+	{
+		if (Subject->IsLinked())
+		{
+			Subject->OnStream(StreamTime, FrameNumber);
+			Subject->GetStreamSchedule().LastStreamTime = StreamTime;
+		}
+	}
+}
+
 //======================================================================
 //
 /*!	\brief	Export static data to a file on a disk.
@@ -967,6 +1113,8 @@ bool MayaLiveLinkStreamManager::ExportSubjectStaticDataToJSON(const MString& Sub
 
 	if (auto Subject = GetSubjectByDagPath(SubjectDagPath))
 	{
+		// The static data must be written even if it was already sent
+		FUnrealStreamManager::TheOne().ResetSentDataHashes();
 		FUnrealStreamManager::TheOne().GetLiveLinkProvider()->EnableFileExport(true, FilePath.asUTF8());
 		Subject->RebuildSubjectData();
 		FUnrealStreamManager::TheOne().GetLiveLinkProvider()->EnableFileExport(false);
@@ -1001,6 +1149,8 @@ bool MayaLiveLinkStreamManager::ExportSubjectFrameDataToJSON(const MString& Subj
 
 	if (auto Subject = GetSubjectByDagPath(SubjectDagPath))
 	{
+		// The frame data must be written even if it was already sent
+		FUnrealStreamManager::TheOne().ResetSentDataHashes();
 		FUnrealStreamManager::TheOne().GetLiveLinkProvider()->EnableFileExport(true, FilePath.asUTF8());
 		Subject->OnStream(0.0, FrameTime);
 		FUnrealStreamManager::TheOne().GetLiveLinkProvider()->EnableFileExport(false);
@@ -1016,18 +1166,231 @@ bool MayaLiveLinkStreamManager::ExportSubjectFrameDataToJSON(const MString& Subj
 
 //======================================================================
 //
-/*!	\brief	Function responsible for streaming all the subjects that are in StreamedSubject array.
-			It loops over all the subjects and call their respective OnStream function.
+/*!	\brief	Function responsible for streaming the subjects that are in StreamedSubject array.
+			High priority subjects (explicitly flagged, the active camera and the selected subjects)
+			are always streamed. The other subjects are served in round-robin order when their
+			target rate is due, until the per tick time budget is exhausted.
+
+	\param[in] bForceAll Stream every subject regardless of its schedule and of the time budget.
 */
-void MayaLiveLinkStreamManager::StreamSubjects() const
+void MayaLiveLinkStreamManager::StreamSubjects(bool bForceAll)
 {
-	double StreamTime = FPlatformTime::Seconds();
-	auto FrameNumber = MAnimControl::currentTime().value();
+	const double StreamTime = FPlatformTime::Seconds();
+	const double FrameNumber = MAnimControl::currentTime().value();
+
+	if (bForceAll)
+	{
+		for (const auto& Subject : StreamedSubjects)
+		{
+			Subject->OnStream(StreamTime, FrameNumber);
+			Subject->GetStreamSchedule().LastStreamTime = StreamTime;
+		}
+		return;
+	}
+
+	StreamScheduledSubjects(StreamTime, FrameNumber, StreamTime + StreamBudgetMs / 1000.0, false);
+}
+
+//======================================================================
+//
+/*!	\brief	Stream the subjects according to their schedule for one frame.
+
+	\param[in] StreamTime    World time of the frame, also used to know if the target rate of a subject is due.
+	\param[in] FrameNumber   Maya frame being streamed.
+	\param[in] BudgetEndTime Time at which the normal priority subjects stop being served, when there is a budget.
+	\param[in] bLookAhead    Stream a frame of the playback look-ahead. The linked subjects are skipped since they
+							 send baked sequences instead of frames, and the look-ahead stamps of the subjects are
+							 used so that the subjects already served for this frame by a previous tick are skipped.
+
+	\return False when the time budget ran out before every subject was visited.
+*/
+bool MayaLiveLinkStreamManager::StreamScheduledSubjects(double StreamTime, double FrameNumber, double BudgetEndTime, bool bLookAhead)
+{
+	auto StreamSubject = [StreamTime, FrameNumber, bLookAhead](IMStreamedEntity& Subject)
+	{
+		auto& Schedule = Subject.GetStreamSchedule();
+		if (!bLookAhead)
+		{
+			Subject.OnStream(StreamTime, FrameNumber);
+			Schedule.LastStreamTime = StreamTime;
+		}
+		else if (!Subject.IsLinked() && !Subject.IsLookAheadFrameStreamed(FrameNumber))
+		{
+			Subject.OnStream(StreamTime, FrameNumber);
+			Schedule.bLookAheadStreamed = true;
+			Schedule.LastLookAheadTime = StreamTime;
+			Schedule.LastLookAheadFrame = FrameNumber;
+		}
+	};
+
+	if (bSelectedSubjectsDirty)
+	{
+		UpdateSelectedSubjects();
+	}
+
+	auto IsHighPriority = [](const IMStreamedEntity& Subject)
+	{
+		const bool bIsActiveCamera = !Subject.ShouldDisplayInUI() && Subject.GetRole() == MStreamedEntity::Camera;
+		const auto& Schedule = Subject.GetStreamSchedule();
+		return bIsActiveCamera || Schedule.bHighPriority || Schedule.bSelected;
+	};
+
+	// Serve the high priority subjects first, they are not subject to the time budget
+	const size_t NumSubjects = StreamedSubjects.size();
+	std::vector<size_t> NormalPrioritySubjects;
+	NormalPrioritySubjects.reserve(NumSubjects);
+	for (size_t Offset = 0; Offset < NumSubjects; ++Offset)
+	{
+		// Start from the round-robin position so that the order of the remaining subjects is rotated
+		const size_t Index = (NextRoundRobinIndex + Offset) % NumSubjects;
+		IMStreamedEntity& Subject = *StreamedSubjects[Index];
+		if (IsHighPriority(Subject))
+		{
+			StreamSubject(Subject);
+		}
+		else
+		{
+			NormalPrioritySubjects.emplace_back(Index);
+		}
+	}
+
+	// Round-robin over the remaining subjects while there is time left in the budget. The first one is
+	// always visited so that the rotation moves on even when the high priority subjects used the budget.
+	auto IsBudgetExhausted = [this, BudgetEndTime]()
+	{
+		return StreamBudgetMs > 0.0 && FPlatformTime::Seconds() >= BudgetEndTime;
+	};
+	bool bVisitedSubject = false;
+	for (const size_t Index : NormalPrioritySubjects)
+	{
+		IMStreamedEntity& Subject = *StreamedSubjects[Index];
+		if (bLookAhead && (Subject.IsLinked() || Subject.IsLookAheadFrameStreamed(FrameNumber)))
+		{
+			continue;
+		}
+
+		if (bVisitedSubject && IsBudgetExhausted())
+		{
+			return false;
+		}
+		bVisitedSubject = true;
+
+		if (bLookAhead ? Subject.IsLookAheadDue(StreamTime) : Subject.IsStreamDue(StreamTime))
+		{
+			StreamSubject(Subject);
+		}
+
+		// The subjects that were not visited will be the first ones to be visited on the next tick
+		NextRoundRobinIndex = (Index + 1) % NumSubjects;
+	}
+
+	return true;
+}
+
+//======================================================================
+//
+/*!	\brief	Flag the subjects which are selected or have a selected descendant, they are high priority.
+			This is only done after the selection or the DAG changed instead of on every tick.
+*/
+void MayaLiveLinkStreamManager::UpdateSelectedSubjects()
+{
+	// Full DAG paths of the selected nodes, used to find out the selected subjects
+	MStringArray SelectedPaths;
+	MSelectionList SelectionList;
+	if (MGlobal::getActiveSelectionList(SelectionList))
+	{
+		for (unsigned int Index = 0; Index < SelectionList.length(); ++Index)
+		{
+			MDagPath SelectedDagPath;
+			if (SelectionList.getDagPath(Index, SelectedDagPath))
+			{
+				SelectedPaths.append(SelectedDagPath.fullPathName());
+			}
+		}
+	}
+	auto IsSelected = [&SelectedPaths](const IMStreamedEntity& Subject)
+	{
+		const MString SubjectPath = Subject.GetDagPath().fullPathName();
+		const MString SubjectPathPrefix = SubjectPath + "|";
+		for (unsigned int Index = 0; Index < SelectedPaths.length(); ++Index)
+		{
+			const MString& SelectedPath = SelectedPaths[Index];
+			if (SelectedPath == SubjectPath ||
+				(SelectedPath.length() > SubjectPathPrefix.length() &&
+				 SelectedPath.substring(0, SubjectPathPrefix.length() - 1) == SubjectPathPrefix))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
 
 	for (const auto& Subject : StreamedSubjects)
 	{
-		Subject->OnStream(StreamTime, FrameNumber);
+		Subject->GetStreamSchedule().bSelected = IsSelected(*Subject);
+	}
+	bSelectedSubjectsDirty = false;
+}
+
+//======================================================================
+//
+/*!	\brief	Stream the upcoming frames of the playback ahead of the current time.
+			Each frame is evaluated in its own DG context and stamped with its scene time and
+			with the world time at which it will be played, so that the buffered interpolation
+			of Live Link can play it back smoothly even if Maya misses a tick. Only the frames
+			of the window that were not sent yet are evaluated, the window restarts when the
+			playback loops or jumps and when the scene is edited.
+
+			Every frame of the window is streamed with the subject schedules: the target rate
+			of a subject applies to the world times of the frames, and the time budget is shared
+			by the whole tick. When the budget runs out, the rest of the window is sent on the
+			next ticks. A frame is only considered sent once every subject was visited, the
+			subjects already served are skipped when the frame is resumed.
+
+	\param[in] bPlaying Whether Maya is playing back the timeline.
+
+	\return True when the frames were streamed, false when the subjects must be streamed
+			at the current time instead.
+*/
+bool MayaLiveLinkStreamManager::StreamPlaybackLookAhead(bool bPlaying)
+{
+	if (PlaybackLookAhead <= 0 || !bPlaying)
+	{
+		bLookAheadStarted = false;
+		return false;
+	}
+
+	const MTime CurrentTime = MAnimControl::currentTime();
+	const MTime FrameStep(MAnimControl::playbackBy(), CurrentTime.unit());
+	const MTime WindowEndTime = std::min(CurrentTime + FrameStep * PlaybackLookAhead, MAnimControl::maxTime());
+
+	// Restart from the current frame when the playback looped, fell behind the window or the scene was edited
+	if (!bLookAheadStarted || LookAheadTime < CurrentTime || LookAheadTime > WindowEndTime)
+	{
+		LookAheadTime = CurrentTime - FrameStep;
+		bLookAheadStarted = true;
+		for (const auto& Subject : StreamedSubjects)
+		{
+			Subject->GetStreamSchedule().bLookAheadStreamed = false;
+		}
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double BudgetEndTime = Now + StreamBudgetMs / 1000.0;
+	for (MTime Time = LookAheadTime + FrameStep; Time <= WindowEndTime; Time += FrameStep)
+	{
+		MDGContext TimeContext(Time);
+		MDGContextGuard ContextGuard(TimeContext);
+
+		const double StreamTime = Now + (Time - CurrentTime).as(MTime::kSeconds);
+		if (!StreamScheduledSubjects(StreamTime, Time.value(), BudgetEndTime, true))
+		{
+			break;
+		}
+		LookAheadTime = Time;
 	}
+
+	return true;
 }
 
 //======================================================================
@@ -1046,11 +1409,56 @@ void MayaLiveLinkStreamManager::StreamSubject(const MDagPath& DagPath) const
 		if (Subject->GetDagPath() == DagPath)
 		{
 			Subject->OnStream(StreamTime, FrameNumber);
+			Subject->GetStreamSchedule().LastStreamTime = StreamTime;
 			break;
 		}
 	}
 }
 
+//======================================================================
+//
+/*!	\brief	Set the stream scheduling of a subject
+
+\param[in] SubjectPathIn     DAG path for the subject.
+\param[in] TargetRate        Number of streams per second, 0 to stream on every tick.
+\param[in] bHighPriority     High priority subjects are always streamed.
+
+\return True if the subject was found.
+*/
+bool MayaLiveLinkStreamManager::SetSubjectStreamSchedule(const MString& SubjectPathIn, double TargetRate, bool bHighPriority)
+{
+	if (auto Subject = GetSubjectByDagPath(SubjectPathIn))
+	{
+		auto& Schedule = Subject->GetStreamSchedule();
+		Schedule.TargetRate = TargetRate > 0.0 ? TargetRate : 0.0;
+		Schedule.bHighPriority = bHighPriority;
+		return true;
+	}
+	return false;
+}
+
+//======================================================================
+//
+/*!	\brief	Get the stream scheduling of a subject
+
+\param[in] SubjectPathIn     DAG path for the subject.
+\param[out] TargetRate       Number of streams per second, 0 when streamed on every tick.
+\param[out] bHighPriority    High priority state of the subject.
+
+\return True if the subject was found.
+*/
+bool MayaLiveLinkStreamManager::GetSubjectStreamSchedule(const MString& SubjectPathIn, double& TargetRate, bool& bHighPriority) const
+{
+	if (auto Subject = GetSubjectByDagPath(SubjectPathIn))
+	{
+		const auto& Schedule = Subject->GetStreamSchedule();
+		TargetRate = Schedule.TargetRate;
+		bHighPriority = Schedule.bHighPriority;
+		return true;
+	}
+	return false;
+}
+
 //======================================================================
 //
 /*!	\brief	Set anim sequence streaming state
@@ -1071,6 +1479,37 @@ bool MayaLiveLinkStreamManager::IsAnimSequenceStreamingPaused()
 	return AnimSequenceStreamingPaused;
 }
 
+//======================================================================
+//
+/*!	\brief	Set the layout of the anim sequence frame data.
+
+			Rebuild the subjects when the layout changes so that the linked
+			subjects are sent again with the role matching the layout.
+
+	\param[in]	bTrackLayout	True to send one contiguous array per channel (track-major),
+								false to send one struct per frame.
+*/
+void MayaLiveLinkStreamManager::SetAnimSequenceTrackLayout(bool bTrackLayout)
+{
+	auto& UnrealStreamManager = FUnrealStreamManager::TheOne();
+	if (UnrealStreamManager.IsAnimSequenceTrackLayout() != bTrackLayout)
+	{
+		UnrealStreamManager.SetAnimSequenceTrackLayout(bTrackLayout);
+		RebuildSubjects(false);
+	}
+}
+
+//======================================================================
+//
+/*!	\brief	Get the layout of the anim sequence frame data.
+
+	\return	True if the frame data is sent track-major.
+*/
+bool MayaLiveLinkStreamManager::IsAnimSequenceTrackLayout() const
+{
+	return FUnrealStreamManager::TheOne().IsAnimSequenceTrackLayout();
+}
+
 //======================================================================
 //
 /*!	\brief	Tell every subject in StreamedSubject list that anim curves are about to be edited.
@@ -1078,6 +1517,7 @@ bool MayaLiveLinkStreamManager::IsAnimSequenceStreamingPaused()
 */
 void MayaLiveLinkStreamManager::OnPreAnimCurvesEdited()
 {
+	RestartPlaybackLookAhead();
 	for (const auto& Subject : StreamedSubjects)
 	{
 		if (Subject->ShouldDisplayInUI())
@@ -1099,8 +1539,8 @@ void MayaLiveLinkStreamManager::OnPreAnimCurvesEdited()
 */
 void MayaLiveLinkStreamManager::OnAttributeChanged(const MDagPath& DagPath, const MObject& Object, const MPlug& Plug, const MPlug& OtherPlug)
 {
-	double StreamTime = FPlatformTime::Seconds();
-	auto FrameNumber = MAnimControl::currentTime().value();
+	// The frames sent ahead don't have the edit
+	RestartPlaybackLookAhead();
 
 	for (auto& Subject : StreamedSubjects)
 	{
@@ -1129,18 +1569,78 @@ void MayaLiveLinkStreamManager::OnTimeUnitChanged()
 		}
 	}
 }
+
+//======================================================================
+//
+/*!	\brief	Register the new parents of reparented nodes on the subjects under them.
+			The reparenting messages are batched, so the subject ancestry is only indexed once per batch.
+
+	\param[in] ChildParentPaths Reparented nodes and their new parent.
+*/
+void MayaLiveLinkStreamManager::OnParentsAdded(const std::vector<std::pair<MDagPath, MDagPath>>& ChildParentPaths)
+{
+	RestartPlaybackLookAhead();
+
+	// Index the subjects by each node of their ancestry
+	std::unordered_multimap<unsigned int, std::pair<MObjectHandle, IMStreamedEntity*>> SubjectAncestry;
+	for (const std::shared_ptr<IMStreamedEntity>& Subject : StreamedSubjects)
+	{
+		if (!Subject->ShouldDisplayInUI())
+		{
+			continue;
+		}
+
+		MDagPath AncestorPath = Subject->GetDagPath();
+		while (AncestorPath.isValid() && AncestorPath.length() > 0)
+		{
+			MObjectHandle AncestorHandle(AncestorPath.node());
+			SubjectAncestry.emplace(AncestorHandle.hashCode(), std::make_pair(AncestorHandle, Subject.get()));
+			AncestorPath.pop();
+		}
+	}
+
+	if (SubjectAncestry.empty())
+	{
+		return;
+	}
+
+	// The same node can be reparented several times in a batch, only register its parent once per subject
+	std::set<std::pair<IMStreamedEntity*, unsigned int>> RegisteredParents;
+	for (const auto& ChildParentPath : ChildParentPaths)
+	{
+		const MDagPath& Child = ChildParentPath.first;
+		const MDagPath& Parent = ChildParentPath.second;
+		if (!Child.isValid() || !Parent.isValid() || Parent.length() == 0)
+		{
+			continue;
+		}
+
+		const MObjectHandle ChildHandle(Child.node());
+		auto Range = SubjectAncestry.equal_range(ChildHandle.hashCode());
+		for (auto It = Range.first; It != Range.second; ++It)
+		{
+			IMStreamedEntity* Subject = It->second.second;
+			MObject ParentObject = Parent.node();
+			if (It->second.first == ChildHandle &&
+				RegisteredParents.emplace(Subject, MObjectHandle(ParentObject).hashCode()).second)
+			{
+				Subject->RegisterParentNode(ParentObject);
+			}
+		}
+	}
+}
 //======================================================================
 //
 /*!	\brief	This function streams static data for Prop subject to UE.
 
 	\param[in] SubjectName Name of the prop subject to be streamed.
-	\param[in] StreamMode  Stream mode for the prop subject.
+	\param[in] StreamRole  Live Link role of the prop subject.
 
 	\return True if the static prop data was streamed.
 */
-bool MayaLiveLinkStreamManager::RebuildPropSubjectData(const MString& SubjectName, const MString& StreamMode)
+bool MayaLiveLinkStreamManager::RebuildPropSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().RebuildPropSubjectData(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().RebuildPropSubjectData(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1148,11 +1648,11 @@ bool MayaLiveLinkStreamManager::RebuildPropSubjectData(const MString& SubjectNam
 /*!	\brief	This function streams frame data for Prop subject to UE.
 
 	\param[in] SubjectName     Name of the prop subject to be streamed.
-	\param[in] StreamMode      Stream mode for the prop subject.
+	\param[in] StreamRole      Live Link role of the prop subject.
 */
-void MayaLiveLinkStreamManager::OnStreamPropSubject(const MString& SubjectName, const MString& StreamMode)
+void MayaLiveLinkStreamManager::OnStreamPropSubject(const FName& SubjectName, EStreamRole StreamRole)
 {
-	FUnrealStreamManager::TheOne().OnStreamPropSubject(SubjectName.asChar(), StreamMode.asChar());
+	FUnrealStreamManager::TheOne().OnStreamPropSubject(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1160,13 +1660,13 @@ void MayaLiveLinkStreamManager::OnStreamPropSubject(const MString& SubjectName,
 /*!	\brief	This function streams static data for Light subject to UE.
 
 	\param[in] SubjectName Name of the light subject to be streamed.
-	\param[in] StreamMode  Stream mode for the light subject.
+	\param[in] StreamRole  Live Link role of the light subject.
 
 	\return True if the static light data was streamed.
 */
-bool MayaLiveLinkStreamManager::RebuildLightSubjectData(const MString& SubjectName, const MString& StreamMode)
+bool MayaLiveLinkStreamManager::RebuildLightSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().RebuildLightSubjectData(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().RebuildLightSubjectData(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1174,11 +1674,11 @@ bool MayaLiveLinkStreamManager::RebuildLightSubjectData(const MString& SubjectNa
 /*!	\brief	This function streams frame data for Light subject to UE.
 
 	\param[in] SubjectName     Name of the light subject to be streamed.
-	\param[in] StreamMode      Stream mode for the light subject.
+	\param[in] StreamRole      Live Link role of the light subject.
 */
-void MayaLiveLinkStreamManager::OnStreamLightSubject(const MString& SubjectName, const MString& StreamMode)
+void MayaLiveLinkStreamManager::OnStreamLightSubject(const FName& SubjectName, EStreamRole StreamRole)
 {
-	FUnrealStreamManager::TheOne().OnStreamLightSubject(SubjectName.asChar(), StreamMode.asChar());
+	FUnrealStreamManager::TheOne().OnStreamLightSubject(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1186,13 +1686,13 @@ void MayaLiveLinkStreamManager::OnStreamLightSubject(const MString& SubjectName,
 /*!	\brief	This function streams static data for Base Camera subject to UE.
 
 	\param[in] SubjectName Name of the prop subject to be streamed.
-	\param[in] StreamMode  Stream mode for the prop subject.
+	\param[in] StreamRole  Live Link role of the prop subject.
 
 	\return True if the static base camera data was streamed.
 */
-bool MayaLiveLinkStreamManager::RebuildBaseCameraSubjectData(const MString& SubjectName, const MString& StreamMode)
+bool MayaLiveLinkStreamManager::RebuildBaseCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().RebuildBaseCameraSubjectData(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().RebuildBaseCameraSubjectData(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1200,11 +1700,11 @@ bool MayaLiveLinkStreamManager::RebuildBaseCameraSubjectData(const MString& Subj
 /*!	\brief	This function streams frame data for Camera subject to UE.
 
 	\param[in] SubjectName     Name of the camera subject to be streamed.
-	\param[in] StreamMode      Stream mode for the camera subject.
+	\param[in] StreamRole      Live Link role of the camera subject.
 */
-void MayaLiveLinkStreamManager::StreamCamera(const MString& SubjectName, const MString& StreamMode)
+void MayaLiveLinkStreamManager::StreamCamera(const FName& SubjectName, EStreamRole StreamRole)
 {
-	FUnrealStreamManager::TheOne().StreamCamera(SubjectName.asChar(), StreamMode.asChar());
+	FUnrealStreamManager::TheOne().StreamCamera(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1212,13 +1712,13 @@ void MayaLiveLinkStreamManager::StreamCamera(const MString& SubjectName, const M
 /*!	\brief	This function streams static data for Camera subject to UE.
 
 	\param[in] SubjectName Name of the camera subject to be streamed.
-	\param[in] StreamMode  Stream mode for the camera subject.
+	\param[in] StreamRole  Live Link role of the camera subject.
 
 	\return True if the static camera data was streamed.
 */
-bool MayaLiveLinkStreamManager::RebuildCameraSubjectData(const MString& SubjectName, const MString& StreamMode)
+bool MayaLiveLinkStreamManager::RebuildCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().RebuildCameraSubjectData(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().RebuildCameraSubjectData(SubjectName, StreamRole);
 }
 
 
@@ -1227,13 +1727,13 @@ bool MayaLiveLinkStreamManager::RebuildCameraSubjectData(const MString& SubjectN
 /*!	\brief	This function streams static data for Joint Hierarchy subject to UE.
 
 	\param[in] SubjectName Name of the joint hierarchy subject to be streamed.
-	\param[in] StreamMode  Stream mode for the joint hierarchy subject.
+	\param[in] StreamRole  Live Link role of the joint hierarchy subject.
 
 	\return True if the static joint hierarchy data was streamed.
 */
-bool MayaLiveLinkStreamManager::RebuildJointHierarchySubject(const MString& SubjectName, const MString& StreamMode)
+bool MayaLiveLinkStreamManager::RebuildJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().RebuildJointHierarchySubjectData(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().RebuildJointHierarchySubjectData(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1241,11 +1741,11 @@ bool MayaLiveLinkStreamManager::RebuildJointHierarchySubject(const MString& Subj
 /*!	\brief	This function streams frame data for Joint Hierarchy subject to UE.
 
 	\param[in] SubjectName   Name of the joint hierarchy to be streamed.
-	\param[in] StreamMode    Stream mode for the joint hierarchy subject.
+	\param[in] StreamRole    Live Link role of the joint hierarchy subject.
 */
-void MayaLiveLinkStreamManager::OnStreamJointHierarchySubject(const MString& SubjectName, const MString& StreamMode)
+void MayaLiveLinkStreamManager::OnStreamJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole)
 {
-	return FUnrealStreamManager::TheOne().OnStreamJointHierarchySubject(SubjectName.asChar(), StreamMode.asChar());
+	return FUnrealStreamManager::TheOne().OnStreamJointHierarchySubject(SubjectName, StreamRole);
 }
 
 //======================================================================
@@ -1254,9 +1754,9 @@ void MayaLiveLinkStreamManager::OnStreamJointHierarchySubject(const MString& Sub
 
 \param[in] SubjectName Name of the subject to be streamed.
 */
-void MayaLiveLinkStreamManager::RebuildAnimSequenceSubject(const MString& SubjectName)
+void MayaLiveLinkStreamManager::RebuildAnimSequenceSubject(const FName& SubjectName)
 {
-	FUnrealStreamManager::TheOne().RebuildAnimSequence(SubjectName.asChar());
+	FUnrealStreamManager::TheOne().RebuildAnimSequence(SubjectName);
 }
 
 //======================================================================
@@ -1265,9 +1765,9 @@ void MayaLiveLinkStreamManager::RebuildAnimSequenceSubject(const MString& Subjec
 
 \param[in] SubjectName   Name of the subject to be streamed.
 */
-void MayaLiveLinkStreamManager::OnStreamAnimSequenceSubject(const MString& SubjectName)
+void MayaLiveLinkStreamManager::OnStreamAnimSequenceSubject(const FName& SubjectName)
 {
-	FUnrealStreamManager::TheOne().OnStreamAnimSequence(SubjectName.asChar());
+	FUnrealStreamManager::TheOne().OnStreamAnimSequence(SubjectName);
 }
 
 //======================================================================
@@ -1276,9 +1776,9 @@ void MayaLiveLinkStreamManager::OnStreamAnimSequenceSubject(const MString& Subje
 
 \param[in] SubjectName Name of the subject to be streamed.
 */
-void MayaLiveLinkStreamManager::RebuildLevelSequenceSubject(const MString& SubjectName)
+void MayaLiveLinkStreamManager::RebuildLevelSequenceSubject(const FName& SubjectName)
 {
-	FUnrealStreamManager::TheOne().RebuildLevelSequence(SubjectName.asChar());
+	FUnrealStreamManager::TheOne().RebuildLevelSequence(SubjectName);
 }
 
 //======================================================================
@@ -1287,9 +1787,9 @@ void MayaLiveLinkStreamManager::RebuildLevelSequenceSubject(const MString& Subje
 
 \param[in] SubjectName   Name of the subject hierarchy to be streamed.
 */
-void MayaLiveLinkStreamManager::OnStreamLevelSequenceSubject(const MString& SubjectName)
+void MayaLiveLinkStreamManager::OnStreamLevelSequenceSubject(const FName& SubjectName)
 {
-	FUnrealStreamManager::TheOne().OnStreamLevelSequence(SubjectName.asChar());
+	FUnrealStreamManager::TheOne().OnStreamLevelSequence(SubjectName);
 }
 
 //======================================================================
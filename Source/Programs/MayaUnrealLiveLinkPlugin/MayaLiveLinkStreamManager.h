@@ -28,11 +28,15 @@
 #include "Subjects/MLiveLinkLightSubject.h"
 #include "Subjects/MLiveLinkPropSubject.h"
 
+#include "UnrealInitializer/FUnrealStreamManager.h"
+
+#include <utility>
 #include <vector>
 
 // Import OpenMaya headers
 THIRD_PARTY_INCLUDES_START
 #include <maya/MStringArray.h>
+#include <maya/MTime.h>
 THIRD_PARTY_INCLUDES_END
 
 // Forward declarations
@@ -57,6 +61,7 @@ public:
 	void GetSubjectPaths(MStringArray& Entries) const;
 	void GetSubjectRoles(MStringArray& Entries) const;
 	void GetSubjectTypes(MStringArray& Entries) const;
+	void GetSubjectCallbackStats(MStringArray& Entries) const;
 	void GetSubjectLinkedAssets(MStringArray& Entries) const;
 	void GetSubjectTargetAssets(MStringArray& Entries) const;
 	void GetSubjectLinkStatus(MStringArray& Entries) const;
@@ -65,7 +70,6 @@ public:
 
 	IMStreamedEntity* GetSubjectByDagPath(const MString& Path) const;
 	IMStreamedEntity* GetSubjectByDagPath(const MDagPath& Path) const;
-	void GetSubjectsFromParentPath(const MDagPath& Path, std::vector<IMStreamedEntity*>& Subjects) const;
 	int GetStreamTypeByDagPath(const MString& Path) const;
 
 	IMStreamedEntity* GetSubjectOwningBlendShape(const MString& Name) const;
@@ -104,17 +108,28 @@ public:
 	void BakeUnrealAsset(const MString& SubjectPathIn);
 	void UnbakeUnrealAsset(const MString& SubjectPathIn);
 
+	void SetSubjectStreamMask(const MString& SubjectPathIn,
+							  const MStringArray& ExcludedJoints,
+							  const MStringArray& ExcludedCurves);
+	bool GetSubjectStreamMask(const MString& SubjectPathIn,
+							  MStringArray& ExcludedJoints,
+							  MStringArray& ExcludedCurves) const;
+	bool SubjectSupportsStreamMask(const MString& SubjectPathIn) const;
+
 	void UpdateProgressBar(int FrameNumber, int NumberOfFrames, int& LastPercentage) const;
 
 	//! Operations on SubjectList
 	void ClearSubjects();
 	void Reset();
 	void RebuildSubjects(bool NeedToRefreshUI = true, bool ForceRelink = false);
+	bool RebuildLinkedSubjects();
+	void StreamLinkedSubjects();
 
 	//! Callback listeners
 	void OnConnectionStatusChanged();
 	void OnAttributeChanged(const MDagPath& DagPath, const MObject& Object, const MPlug& Plug, const MPlug& OtherPlug);
 	void OnTimeUnitChanged();
+	void OnParentsAdded(const std::vector<std::pair<MDagPath, MDagPath>>& ChildParentPaths);
 
 	//! Export static and frame(animated) data to JSON
 	bool ExportSubjectStaticDataToJSON(const MString& SubjectDagPath,
@@ -127,47 +142,75 @@ public:
 	//! Make a unique name for a subject being added
 	MString MakeUniqueName(const MString& SubjectName);
 
-	//! Stream all subjects to LL provider
-	void StreamSubjects() const;
+	//! Stream the subjects to LL provider. Unless bForceAll is set, subjects are scheduled
+	//! according to their target rate and priority within the per tick time budget.
+	void StreamSubjects(bool bForceAll = false);
 
 	void StreamSubject(const MDagPath& DagPath) const;
 
+	//! Per subject stream scheduling
+	bool SetSubjectStreamSchedule(const MString& SubjectPathIn, double TargetRate, bool bHighPriority);
+	bool GetSubjectStreamSchedule(const MString& SubjectPathIn, double& TargetRate, bool& bHighPriority) const;
+
+	//! Time budget in milliseconds to stream the subjects in a tick, 0 for no budget
+	void SetStreamBudget(double BudgetMs) { StreamBudgetMs = BudgetMs > 0.0 ? BudgetMs : 0.0; }
+	double GetStreamBudget() const { return StreamBudgetMs; }
+
+	//! Number of upcoming frames evaluated and sent ahead of the current time during playback,
+	//! 0 to only send the current frame
+	void SetPlaybackLookAhead(int NumFrames) { PlaybackLookAhead = NumFrames > 0 ? NumFrames : 0; }
+	int GetPlaybackLookAhead() const { return PlaybackLookAhead; }
+
+	//! Send the frames of the look-ahead window that were not sent yet. Returns false when
+	//! Maya isn't playing or the look-ahead is disabled.
+	bool StreamPlaybackLookAhead(bool bPlaying);
+
+	//! Send the whole look-ahead window again on the next tick, the frames already sent are out of date
+	void RestartPlaybackLookAhead() { bLookAheadStarted = false; }
+
+	//! Find the selected subjects again on the next tick, after the selection or the DAG changed
+	void InvalidateSelectedSubjects() { bSelectedSubjectsDirty = true; }
+
 	//! Anim sequence streaming state
 	void PauseAnimSequenceStreaming(bool PauseState);
 
 	bool IsAnimSequenceStreamingPaused();
 
+	//! Send the anim sequence frame data with one contiguous array per channel instead of per frame
+	void SetAnimSequenceTrackLayout(bool bTrackLayout);
+	bool IsAnimSequenceTrackLayout() const;
+
 	void OnPreAnimCurvesEdited();
 
 	//! Remove a subject from LL provider
 	void RemoveSubjectFromLiveLink(const MString& SubjectName);
 
 	//! Prop Subject static and frame data streaming
-	bool RebuildPropSubjectData(const MString& SubjectName, const MString& StreamMode);
-	void OnStreamPropSubject(const MString& SubjectName, const MString& StreamMode);
+	bool RebuildPropSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamPropSubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! Light Subject static and frame data streaming
-	bool RebuildLightSubjectData(const MString& SubjectName, const MString& StreamMode);
-	void OnStreamLightSubject(const MString& SubjectName, const MString& StreamMode);
+	bool RebuildLightSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamLightSubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! Base Camera Subject static and frame data streaming
-	bool RebuildBaseCameraSubjectData(const MString& SubjectName, const MString& StreamMode);
-	void StreamCamera(const MString& SubjectName, const MString& StreamMode);
+	bool RebuildBaseCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void StreamCamera(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! Camera Subject static and frame data streaming
-	bool RebuildCameraSubjectData(const MString& SubjectName, const MString& StreamMode);
+	bool RebuildCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! Joint Hierarchy Subject static and frame data streaming
-	bool RebuildJointHierarchySubject(const MString& SubjectName, const MString& StreamMode);
-	void OnStreamJointHierarchySubject(const MString& SubjectName, const MString& StreamMode);
+	bool RebuildJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! AnimSequence static and frame data streaming
-	void RebuildAnimSequenceSubject(const MString& SubjectName);
-	void OnStreamAnimSequenceSubject(const MString& SubjectName);
+	void RebuildAnimSequenceSubject(const FName& SubjectName);
+	void OnStreamAnimSequenceSubject(const FName& SubjectName);
 
 	//! LevelSequence static and frame data streaming
-	void RebuildLevelSequenceSubject(const MString& SubjectName);
-	void OnStreamLevelSequenceSubject(const MString& SubjectName);
+	void RebuildLevelSequenceSubject(const FName& SubjectName);
+	void OnStreamLevelSequenceSubject(const FName& SubjectName);
 
 	//! Active camera
 	MDagPath GetActiveCameraSubjectPath() const;
@@ -185,9 +228,34 @@ private:
 	//! Private constructor. Access to the members is provided by TheOne()
 	MayaLiveLinkStreamManager();
 
+	//! Stream the subjects of a frame according to their schedule. Returns false when the budget ran out
+	//! before every subject was visited.
+	bool StreamScheduledSubjects(double StreamTime, double FrameNumber, double BudgetEndTime, bool bLookAhead);
+
+	//! Flag the subjects which are selected or have a selected descendant
+	void UpdateSelectedSubjects();
+
 	//! Anim sequence streaming pause state
 	bool AnimSequenceStreamingPaused;
 
 	//! List of streamed subjects.
 	std::vector<std::shared_ptr<IMStreamedEntity>> StreamedSubjects;
+
+	//! Time budget in milliseconds to stream the subjects in a tick
+	double StreamBudgetMs;
+
+	//! Next subject to be served by the round-robin scheduling
+	size_t NextRoundRobinIndex;
+
+	//! The selected subjects must be found again before the next tick
+	bool bSelectedSubjectsDirty;
+
+	//! Playback look-ahead window size and last frame sent ahead of the current time
+	int PlaybackLookAhead;
+	MTime LookAheadTime;
+	bool bLookAheadStarted;
+
+	//! Playback range the linked subjects were last baked with
+	MTime BakedRangeStart;
+	MTime BakedRangeEnd;
 };
@@ -20,7 +20,9 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
 
 #include "RequiredProgramMainCPPInclude.h"
 
@@ -33,11 +35,16 @@
 
 #include "Shared/UdpMessagingSettings.h"
 
+#include "Subjects/MSceneDeformerIndex.h"
+
 #include "UnrealInitializer/FUnrealStreamManager.h"
+#include "UnrealInitializer/ProfilingLiveLinkProducer.h"
 #include "UnrealInitializer/UnrealInitializer.h"
 
+#include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 IMPLEMENT_APPLICATION(MayaUnrealLiveLinkPlugin, "MayaUnrealLiveLinkPlugin");
 
@@ -64,6 +71,7 @@ THIRD_PARTY_INCLUDES_START
 #include <maya/MFnMotionPath.h>
 #include <maya/MObjectArray.h>
 #include <maya/MPxCommand.h>
+#include <maya/MSelectionList.h>
 #include <maya/MSyntax.h>
 THIRD_PARTY_INCLUDES_END
 
@@ -83,23 +91,47 @@ class FLiveLinkStreamedSubjectManager;
 void OnTimeChangedReceived(const FQualifiedFrameTime& Time);
 void ClearViewportCallbacks();
 MStatus RefreshViewportCallbacks();
+void QueueViewportCallbacksRefresh();
 
 MCallbackIdArray myCallbackIds;
 
 MSpace::Space G_TransformSpace = MSpace::kTransform;
 
 static bool PreviousConnectionStatus = false;
+
+// Time in seconds without playback range change before the linked subjects are baked again
+static double PlaybackRangeQuietPeriod = 2.0;
+// Re-bakes started once the playback range stayed the same for the quiet period, reported by LiveLinkRebakeDelay
+static unsigned int NumPlaybackRangeRebakes = 0;
 static bool ChangeTimeDone = true;
 static bool IgnoreAllDagChangesCallback = false;
 
+// Reparent messages received and batches processed on idle, reported by LiveLinkDagChangeStats
+static unsigned int NumDagChangeMessages = 0;
+static unsigned int NumDagChangeBatches = 0;
+
+// Set when the plugin starts shutting down, the idle tasks still queued and the late
+// callbacks from the messaging threads must not touch the subjects or the providers anymore
+static std::atomic<bool> PluginShuttingDown(false);
+
 // PluginVersion definition has been moved to MayaLiveLinkInterface.cpp
 static std::string PluginVersion;
 const char PluginAppId[] = "3726213941804942083";
 
 static const char OtherUEVersionLoadedEnvVar[] = "OtherUEVersionLoaded";
 
+// Unreal initialization profile: "Minimal" (default) or "Full", initial live link source and core limit
+static const char InitProfileEnvVar[] = "MAYA_UNREAL_LIVELINK_INIT_PROFILE";
+static const char InitSourceEnvVar[] = "MAYA_UNREAL_LIVELINK_SOURCE";
+static const char CoreLimitEnvVar[] = "MAYA_UNREAL_LIVELINK_CORE_LIMIT";
+
 void RebuildStreamSubjects(void* ClientData)
 {
+	if (PluginShuttingDown)
+	{
+		return;
+	}
+
 	auto& LiveLinkStreamManager = MayaLiveLinkStreamManager::TheOne();
 	if (PreviousConnectionStatus)
 	{
@@ -110,12 +142,17 @@ void RebuildStreamSubjects(void* ClientData)
 		using namespace std::chrono_literals;
 		std::this_thread::sleep_for(100ms);
 
-		LiveLinkStreamManager.StreamSubjects();
+		LiveLinkStreamManager.StreamSubjects(true);
 	}
 }
 
 void OnConnectionStatusChanged()
 {
+	if (PluginShuttingDown)
+	{
+		return;
+	}
+
 	auto LiveLinkProvider = FUnrealStreamManager::TheOne().GetLiveLinkProvider();
 	if (LiveLinkProvider.IsValid())
 	{
@@ -128,6 +165,11 @@ void OnConnectionStatusChanged()
 
 			if (bHasConnection)
 			{
+				// Providers that don't replay the static data to new connections need a full resend
+				if (!LiveLinkProvider->ReplaysStaticDataOnConnect())
+				{
+					FUnrealStreamManager::TheOne().ResetSentDataHashes();
+				}
 				MGlobal::executeTaskOnIdle(RebuildStreamSubjects, nullptr, MGlobal::kVeryLowIdlePriority);
 			}
 		}
@@ -1126,6 +1168,8 @@ constexpr char LiveLinkMessagingSettingsCommand::AddEndpointFlagLong[];
 constexpr char LiveLinkMessagingSettingsCommand::RemoveEndpointFlag[];
 constexpr char LiveLinkMessagingSettingsCommand::RemoveEndpointFlagLong[];
 
+void SaveSettingPreferences(const char* SettingName);
+
 const MString LiveLinkChangeSourceCommandName("LiveLinkChangeSource");
 
 class LiveLinkChangeSourceCommand : public MPxCommand
@@ -1153,6 +1197,9 @@ public:
 			UnrealInitializer::TheOne().StartLiveLink(OnConnectionStatusChanged, OnTimeChangedReceived);
 			MayaLiveLinkStreamManager::TheOne().Reset();
 			MayaLiveLinkStreamManager::TheOne().RebuildSubjects();
+
+			// Unreal is initialized for this source in the next sessions
+			SaveSettingPreferences("source");
 		}
 
 		return MS::kSuccess;
@@ -1206,6 +1253,8 @@ public:
 
 	MStatus			doIt(const MArgList& args) override
 	{
+		// Explicit request to send the subjects, don't skip the unchanged static data
+		FUnrealStreamManager::TheOne().ResetSentDataHashes();
 		MayaLiveLinkStreamManager::TheOne().RebuildSubjects();
 
 		return MS::kSuccess;
@@ -1589,214 +1638,1059 @@ constexpr char LiveLinkPauseAnimSyncCommand::EnableFlag[];
 constexpr char LiveLinkPauseAnimSyncCommand::EnableFlagLong[];
 bool LiveLinkPauseAnimSyncCommand::bPausedState = false;
 
-void OnMayaExit(void* client)
-{
-	MayaLiveLinkStreamManager::TheOne().ClearSubjects();
-}
-
-void OnScenePreOpen(void* Client)
-{
-	ClearViewportCallbacks();
-	MayaLiveLinkStreamManager::TheOne().Reset();
-	MayaUnrealLiveLinkUtils::RefreshUI();
-}
-
-void OnScenePreNew(void* Client)
+class LiveLinkSubjectStreamMaskCommand : public MPxCommand
 {
-	OnScenePreOpen(Client);
-}
+public:
+	static constexpr char CommandName[] = "LiveLinkSubjectStreamMask";
 
-void OnSceneOpen(void* Client)
-{
-	MGlobal::executeCommandOnIdle("MayaUnrealLiveLinkOnSceneOpen");
-}
+	static constexpr char ExcludeJointsFlag[] = "ej";
+	static constexpr char ExcludeJointsFlagLong[] = "excludeJoints";
+	static constexpr char ExcludeCurvesFlag[] = "ec";
+	static constexpr char ExcludeCurvesFlagLong[] = "excludeCurves";
 
-bool CameraManipStarted = false;
-bool AnimCurveEdited = false;
-bool AnimKeyFrameEdited = false;
-MTime::Unit CurrentTimeUnit = MTime::kInvalid;
-bool gTimeChangedReceived = false;
-FQualifiedFrameTime TimeReceived;
-std::atomic<bool> SendUpdatedData {false};
-std::atomic<bool> IsManipulationComplete { false };
-std::chrono::steady_clock::time_point LastSendTime;
-const int MinTimeIntervalMs = 50;
+	static void* Creator() { return new LiveLinkSubjectStreamMaskCommand(); }
 
-// Helper method to send data to unreal when SendUpdatedData is set.
-void StreamDataToUnreal()
-{
-	if (!LiveLinkObjectTransformSyncCommand::IsEnabled() && !SendUpdatedData) 
+	static MSyntax CreateSyntax()
 	{
-		return;
-	}
+		MStatus Status;
+		MSyntax Syntax;
 
-	if (gTimeChangedReceived)
-	{
-		gTimeChangedReceived = false;
-		return;
-	}
+		Syntax.enableQuery(true);
 
-	auto Now = std::chrono::high_resolution_clock::now();
-	auto TimeElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Now - LastSendTime).count();
-	
-	if(!SendUpdatedData && TimeElapsed < MinTimeIntervalMs && !IsManipulationComplete)
-		return;
+		// The first object is the subject DAG path, the following ones are the names to exclude
+		Status = Syntax.setObjectType(MSyntax::kStringObjects, 1);
+		CHECK_MSTATUS(Status);
 
-	IsManipulationComplete = false;
-	LastSendTime = Now;
+		Status = Syntax.addFlag(ExcludeJointsFlag, ExcludeJointsFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(ExcludeCurvesFlag, ExcludeCurvesFlagLong);
+		CHECK_MSTATUS(Status);
 
-	auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
-	auto TimeUnit = MAnimControl::currentTime().unit();
-	if (TimeUnit != CurrentTimeUnit)
-	{
-		CurrentTimeUnit = TimeUnit;
-		StreamManager.OnTimeUnitChanged();
+		return Syntax;
 	}
 
-	if (!CameraManipStarted && !AnimCurveEdited && !AnimKeyFrameEdited)
+	MStatus doIt(const MArgList& args) override
 	{
-		auto LiveLinkProvider = FUnrealStreamManager::TheOne().GetLiveLinkProvider();
-		if (LiveLinkPlayheadSyncCommand::IsEnabled() &&
-			LiveLinkProvider.IsValid() &&
-			LiveLinkProvider->HasConnection())
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		MStringArray Objects;
+		Status = ArgData.getObjects(Objects);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		const bool bExcludeJoints = ArgData.isFlagSet(ExcludeJointsFlag, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+		const bool bExcludeCurves = ArgData.isFlagSet(ExcludeCurvesFlag, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		if ((static_cast<int>(bExcludeJoints) + static_cast<int>(bExcludeCurves)) != 1)
 		{
-			LiveLinkProvider->OnTimeChanged(MayaUnrealLiveLinkUtils::GetMayaFrameTimeAsUnrealTime());
+			MString ErrorMsg;
+			ErrorMsg.format(
+				"Must specify exactly one of -^1s or -^2s",
+				ExcludeJointsFlagLong, ExcludeCurvesFlagLong);
+			displayError(ErrorMsg);
+			return MS::kFailure;
+		}
 
-			// Need to sleep the thread so that the OnTimeChanged message is sent to Unreal
-			using namespace std::chrono_literals;
-			std::this_thread::sleep_for(20ms);
+		const MString SubjectPath = Objects[0];
+		auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+
+		MStringArray ExcludedJoints;
+		MStringArray ExcludedCurves;
+		if (!StreamManager.GetSubjectStreamMask(SubjectPath, ExcludedJoints, ExcludedCurves))
+		{
+			MString ErrorMsg;
+			ErrorMsg.format("\"^1s\" is not a Live Link subject", SubjectPath);
+			displayError(ErrorMsg);
+			return MS::kFailure;
 		}
 
-		StreamManager.StreamSubjects();
+		MStringArray& ExcludedNames = bExcludeJoints ? ExcludedJoints : ExcludedCurves;
+		if (ArgData.isQuery())
+		{
+			setResult(ExcludedNames);
+			return MS::kSuccess;
+		}
 
-	}
-	else
-	{
-		if (!AnimCurveEdited)
+		// Only the joint hierarchy subjects can be masked, the others report an empty mask when queried
+		if (!StreamManager.SubjectSupportsStreamMask(SubjectPath))
 		{
-			// If anim curve edited was clear, we can then clear the anim key framed edited flag
-			// That's because Maya sends 2 OnTimeChanged events that we want to ignore.
-			AnimKeyFrameEdited = false;
+			MString ErrorMsg;
+			ErrorMsg.format("\"^1s\" doesn't support a streaming mask, only joint hierarchy subjects do", SubjectPath);
+			displayError(ErrorMsg);
+			return MS::kFailure;
 		}
-		else
+
+		// Replace the list of excluded names, an empty list clears the mask
+		ExcludedNames.clear();
+		for (unsigned int Index = 1; Index < Objects.length(); ++Index)
 		{
-			AnimCurveEdited = false;
+			ExcludedNames.append(Objects[Index]);
 		}
+
+		StreamManager.SetSubjectStreamMask(SubjectPath, ExcludedJoints, ExcludedCurves);
+		setResult(true);
+
+		return MS::kSuccess;
 	}
+};
+constexpr char LiveLinkSubjectStreamMaskCommand::CommandName[];
+constexpr char LiveLinkSubjectStreamMaskCommand::ExcludeJointsFlag[];
+constexpr char LiveLinkSubjectStreamMaskCommand::ExcludeJointsFlagLong[];
+constexpr char LiveLinkSubjectStreamMaskCommand::ExcludeCurvesFlag[];
+constexpr char LiveLinkSubjectStreamMaskCommand::ExcludeCurvesFlagLong[];
 
-	// Set the streaming flag to false.
-	SendUpdatedData = false;
-}
+void CompleteUnrealInitialization();
+void CheckPlaybackRangeRebake();
 
-void StreamOnIdleTask(void* ClientData)
+// Let the UI plug-in save a setting changed by a command in its optionVars
+void SaveSettingPreferences(const char* SettingName)
 {
-	if (!ClientData)
-	{
-		return;
-	}
+	MString Command;
+	Command.format("if (`exists MayaUnrealLiveLinkSavePreferences`) MayaUnrealLiveLinkSavePreferences \"^1s\"", SettingName);
+	MGlobal::executeCommand(Command);
+}
 
-	IsManipulationComplete = true;
+class LiveLinkStreamScheduleCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkStreamSchedule";
 
-	// In some situations (such as manipulating an HIK Effector in Full Body mode), a lot of Attributes can be
-	// changing at once, and each of those attribute changes registers for an Idle callback. This results in 
-	// lots of sends for the same Subject at one time. This map protects against that by not sending it again
-	// for the same Subject if we sent very recently.
-	static std::unordered_map<void*, double> s_mostRecentSends;
-	double StreamTime = FPlatformTime::Seconds();
+	static constexpr char RateFlag[] = "r";
+	static constexpr char RateFlagLong[] = "rate";
+	static constexpr char HighPriorityFlag[] = "hp";
+	static constexpr char HighPriorityFlagLong[] = "highPriority";
+	static constexpr char BudgetFlag[] = "b";
+	static constexpr char BudgetFlagLong[] = "budget";
 
-	std::shared_ptr<IMStreamedEntity> Subject = *static_cast<std::shared_ptr<IMStreamedEntity>*>(ClientData);
+	static void* Creator() { return new LiveLinkStreamScheduleCommand(); }
 
-	auto it = s_mostRecentSends.find(ClientData);
-	if (it != s_mostRecentSends.end())
+	static MSyntax CreateSyntax()
 	{
-		if (StreamTime - it->second < (1.0 / static_cast<double>(MinTimeIntervalMs)))
-			return;
-	}
+		MStatus Status;
+		MSyntax Syntax;
 
-	auto FrameNumber = MAnimControl::currentTime().value();
-	Subject->OnStream(StreamTime, FrameNumber);
+		Syntax.enableQuery(true);
 
-	s_mostRecentSends[ClientData] = StreamTime;
-}
+		// Optional subject DAG path, required by the -rate and -highPriority flags
+		Status = Syntax.setObjectType(MSyntax::kStringObjects, 0, 1);
+		CHECK_MSTATUS(Status);
 
-void StreamOnIdle(std::shared_ptr<IMStreamedEntity>& Subject, MGlobal::MIdleTaskPriority Priority)
-{
-	MGlobal::executeTaskOnIdle(StreamOnIdleTask, &Subject, Priority);
-}
+		Status = Syntax.addFlag(RateFlag, RateFlagLong, MSyntax::kDouble);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(HighPriorityFlag, HighPriorityFlagLong, MSyntax::kBoolean);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(BudgetFlag, BudgetFlagLong, MSyntax::kDouble);
+		CHECK_MSTATUS(Status);
 
-void OnTimeChanged(MTime& Time, void* ClientData)
-{
-	SendUpdatedData = true;
-	AnimCurveEdited  = false;
-	AnimKeyFrameEdited = false;
-}
+		return Syntax;
+	}
 
-int FindMatchingDagPath(const MString& DagPathName, const MFnDagNode& DagNode, const MStringArray& SubjectPaths, MDagPath& SubjectDagPath)
-{
-	int PathIndex = -1;
-	const auto SubjectPathLen = SubjectPaths.length();
-	for (unsigned int path = 0; path < SubjectPathLen; ++path)
+	MStatus doIt(const MArgList& args) override
 	{
-		const MString& SubjectPath = SubjectPaths[path];
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
 
-		MSelectionList SelectionList;
-		SelectionList.add(SubjectPath);
-		MObject SubjectObj;
-		SelectionList.getDependNode(0, SubjectObj);
-		SelectionList.getDagPath(0, SubjectDagPath);
+		MStringArray Objects;
+		Status = ArgData.getObjects(Objects);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
 
-		if (SubjectPath == DagPathName)
+		const bool bRate = ArgData.isFlagSet(RateFlag);
+		const bool bHighPriority = ArgData.isFlagSet(HighPriorityFlag);
+		const bool bBudget = ArgData.isFlagSet(BudgetFlag);
+
+		// The subjects need the engine, the other settings can be changed while Unreal is initializing
+		if (Objects.length() > 0 || bRate || bHighPriority)
 		{
-			PathIndex = path;
-			break;
+			CompleteUnrealInitialization();
 		}
-		else
+
+		auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+
+		if (bBudget)
 		{
-			MDagPath ShapeDagPath = SubjectDagPath;
-			ShapeDagPath.extendToShape();
-			if (ShapeDagPath.fullPathName() == DagPathName)
+			if (ArgData.isQuery())
 			{
-				PathIndex = path;
-				break;
+				setResult(StreamManager.GetStreamBudget());
+				return MS::kSuccess;
 			}
-			else if (PathIndex == -1 && DagNode.isChildOf(SubjectObj))
+
+			double BudgetMs = 0.0;
+			ArgData.getFlagArgument(BudgetFlag, 0, BudgetMs);
+			StreamManager.SetStreamBudget(BudgetMs);
+			SaveSettingPreferences("budget");
+		}
+
+		if (!bRate && !bHighPriority)
+		{
+			if (!bBudget)
 			{
-				PathIndex = path;
+				MString ErrorMsg;
+				ErrorMsg.format(
+					"Must specify one of -^1s, -^2s or -^3s",
+					RateFlagLong, HighPriorityFlagLong, BudgetFlagLong);
+				displayError(ErrorMsg);
+				return MS::kFailure;
 			}
+			setResult(true);
+			return MS::kSuccess;
 		}
-	}
 
-	return PathIndex;
-}
+		double TargetRate = 0.0;
+		bool bIsHighPriority = false;
+		if (Objects.length() == 0 ||
+			!StreamManager.GetSubjectStreamSchedule(Objects[0], TargetRate, bIsHighPriority))
+		{
+			displayError("Must specify a Live Link subject DAG path");
+			return MS::kFailure;
+		}
 
-bool FindNodeAffectedByConstraint(const MObject& Node, const MStringArray& SubjectPaths, MObject& NodeWithConstraint)
-{
-	MFnDependencyNode DependNode(Node);
-	MObject Constraint;
-	MPlug ParentMatrixPlugArray = DependNode.findPlug("parentMatrix", false);
-	if (!ParentMatrixPlugArray.isNull() && ParentMatrixPlugArray.isArray())
-	{
-		const unsigned int SubjectPathLen = SubjectPaths.length();
-		for (unsigned int ParentMatrixIndex = 0; ParentMatrixIndex < ParentMatrixPlugArray.numElements(); ++ParentMatrixIndex)
+		if (ArgData.isQuery())
 		{
-			MPlug DependPlug = ParentMatrixPlugArray[ParentMatrixIndex];
-			MPlugArray DependConnections;
-			DependPlug.connectedTo(DependConnections, false, true);
-			for (unsigned int DependIdx = 0; DependIdx < DependConnections.length(); ++DependIdx)
+			if (bRate)
 			{
-				MPlug DependConnection = DependConnections[DependIdx];
-				MObject DependObject = DependConnection.node();
-				if (DependObject.hasFn(MFn::kConstraint))
-				{
-					for (unsigned int path = 0; path < SubjectPathLen; ++path)
-					{
-						const MString& SubjectPath = SubjectPaths[path];
+				setResult(TargetRate);
+			}
+			else
+			{
+				setResult(bIsHighPriority);
+			}
+			return MS::kSuccess;
+		}
 
-						MSelectionList SelectionList;
-						SelectionList.add(SubjectPath);
-						MDagPath SubjectDagPath;
-						MObject SubjectObj;
-						SelectionList.getDependNode(0, SubjectObj);
+		if (bRate)
+		{
+			ArgData.getFlagArgument(RateFlag, 0, TargetRate);
+		}
+		if (bHighPriority)
+		{
+			ArgData.getFlagArgument(HighPriorityFlag, 0, bIsHighPriority);
+		}
+		setResult(StreamManager.SetSubjectStreamSchedule(Objects[0], TargetRate, bIsHighPriority));
+
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkStreamScheduleCommand::CommandName[];
+constexpr char LiveLinkStreamScheduleCommand::RateFlag[];
+constexpr char LiveLinkStreamScheduleCommand::RateFlagLong[];
+constexpr char LiveLinkStreamScheduleCommand::HighPriorityFlag[];
+constexpr char LiveLinkStreamScheduleCommand::HighPriorityFlagLong[];
+constexpr char LiveLinkStreamScheduleCommand::BudgetFlag[];
+constexpr char LiveLinkStreamScheduleCommand::BudgetFlagLong[];
+
+class LiveLinkRebakeDelayCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkRebakeDelay";
+
+	static constexpr char SecondsFlag[] = "s";
+	static constexpr char SecondsFlagLong[] = "seconds";
+	static constexpr char RebakesFlag[] = "rb";
+	static constexpr char RebakesFlagLong[] = "rebakes";
+	static constexpr char TickFlag[] = "t";
+	static constexpr char TickFlagLong[] = "tick";
+
+	static void* Creator() { return new LiveLinkRebakeDelayCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Syntax.enableQuery(true);
+
+		Status = Syntax.addFlag(SecondsFlag, SecondsFlagLong, MSyntax::kDouble);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(RebakesFlag, RebakesFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(TickFlag, TickFlagLong);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		// Check the pending re-bake once like the timer does, batch mode doesn't run the timers
+		if (ArgData.isFlagSet(TickFlag))
+		{
+			CheckPlaybackRangeRebake();
+		}
+
+		// Number of re-bakes started by playback range changes
+		if (ArgData.isFlagSet(RebakesFlag))
+		{
+			setResult(static_cast<int>(NumPlaybackRangeRebakes));
+			return MS::kSuccess;
+		}
+
+		// The linked subjects are baked again once the playback range stayed the same for this delay
+		if (ArgData.isQuery() || !ArgData.isFlagSet(SecondsFlag))
+		{
+			setResult(PlaybackRangeQuietPeriod);
+			return MS::kSuccess;
+		}
+
+		double Delay = 0.0;
+		ArgData.getFlagArgument(SecondsFlag, 0, Delay);
+		PlaybackRangeQuietPeriod = Delay > 0.0 ? Delay : 0.0;
+		SaveSettingPreferences("rebakeDelay");
+
+		setResult(PlaybackRangeQuietPeriod);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkRebakeDelayCommand::CommandName[];
+constexpr char LiveLinkRebakeDelayCommand::SecondsFlag[];
+constexpr char LiveLinkRebakeDelayCommand::SecondsFlagLong[];
+constexpr char LiveLinkRebakeDelayCommand::RebakesFlag[];
+constexpr char LiveLinkRebakeDelayCommand::RebakesFlagLong[];
+constexpr char LiveLinkRebakeDelayCommand::TickFlag[];
+constexpr char LiveLinkRebakeDelayCommand::TickFlagLong[];
+
+class LiveLinkFrameHeartbeatCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkFrameHeartbeat";
+
+	static constexpr char SecondsFlag[] = "s";
+	static constexpr char SecondsFlagLong[] = "seconds";
+
+	static void* Creator() { return new LiveLinkFrameHeartbeatCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Syntax.enableQuery(true);
+
+		Status = Syntax.addFlag(SecondsFlag, SecondsFlagLong, MSyntax::kDouble);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		// Unchanged frames are only sent again after this interval, 0 sends every frame
+		auto& UnrealStreamManager = FUnrealStreamManager::TheOne();
+		if (ArgData.isQuery() || !ArgData.isFlagSet(SecondsFlag))
+		{
+			setResult(UnrealStreamManager.GetFrameHeartbeat());
+			return MS::kSuccess;
+		}
+
+		double HeartbeatSeconds = 0.0;
+		ArgData.getFlagArgument(SecondsFlag, 0, HeartbeatSeconds);
+		UnrealStreamManager.SetFrameHeartbeat(HeartbeatSeconds);
+		SaveSettingPreferences("heartbeat");
+
+		setResult(UnrealStreamManager.GetFrameHeartbeat());
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkFrameHeartbeatCommand::CommandName[];
+constexpr char LiveLinkFrameHeartbeatCommand::SecondsFlag[];
+constexpr char LiveLinkFrameHeartbeatCommand::SecondsFlagLong[];
+
+class LiveLinkPlaybackLookAheadCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkPlaybackLookAhead";
+
+	static constexpr char FramesFlag[] = "f";
+	static constexpr char FramesFlagLong[] = "frames";
+
+	static void* Creator() { return new LiveLinkPlaybackLookAheadCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Syntax.enableQuery(true);
+
+		Status = Syntax.addFlag(FramesFlag, FramesFlagLong, MSyntax::kLong);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		// Number of upcoming frames sent ahead of the current time during playback, 0 to disable the look-ahead
+		auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+		if (ArgData.isQuery() || !ArgData.isFlagSet(FramesFlag))
+		{
+			setResult(StreamManager.GetPlaybackLookAhead());
+			return MS::kSuccess;
+		}
+
+		int NumFrames = 0;
+		ArgData.getFlagArgument(FramesFlag, 0, NumFrames);
+		StreamManager.SetPlaybackLookAhead(NumFrames);
+		SaveSettingPreferences("lookAhead");
+
+		setResult(StreamManager.GetPlaybackLookAhead());
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkPlaybackLookAheadCommand::CommandName[];
+constexpr char LiveLinkPlaybackLookAheadCommand::FramesFlag[];
+constexpr char LiveLinkPlaybackLookAheadCommand::FramesFlagLong[];
+
+class LiveLinkStreamTickCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkStreamTick";
+
+	static constexpr char PlayingFlag[] = "p";
+	static constexpr char PlayingFlagLong[] = "playing";
+
+	static void* Creator() { return new LiveLinkStreamTickCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Status = Syntax.addFlag(PlayingFlag, PlayingFlagLong);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		// Stream the subjects once like on a tick, with the current schedule and budget. With -playing,
+		// the tick streams the look-ahead window like during the playback.
+		auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+		if (!StreamManager.StreamPlaybackLookAhead(ArgData.isFlagSet(PlayingFlag)))
+		{
+			StreamManager.StreamSubjects();
+		}
+
+		setResult(true);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkStreamTickCommand::CommandName[];
+constexpr char LiveLinkStreamTickCommand::PlayingFlag[];
+constexpr char LiveLinkStreamTickCommand::PlayingFlagLong[];
+
+class LiveLinkDestinationsCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkDestinations";
+
+	static constexpr char AddJSONFlag[] = "aj";
+	static constexpr char AddJSONFlagLong[] = "addJSON";
+	static constexpr char RemoveJSONFlag[] = "rj";
+	static constexpr char RemoveJSONFlagLong[] = "removeJSON";
+	static constexpr char MessageBusFlag[] = "mb";
+	static constexpr char MessageBusFlagLong[] = "messageBus";
+	static constexpr char RemoveAllFlag[] = "ra";
+	static constexpr char RemoveAllFlagLong[] = "removeAll";
+	static constexpr char JSONEndpointFlag[] = "je";
+	static constexpr char JSONEndpointFlagLong[] = "jsonEndpoint";
+
+	static void* Creator() { return new LiveLinkDestinationsCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Syntax.enableQuery(true);
+
+		// JSON endpoints are specified as "address:port"
+		Status = Syntax.addFlag(AddJSONFlag, AddJSONFlagLong, MSyntax::kString);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.makeFlagMultiUse(AddJSONFlag);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(RemoveJSONFlag, RemoveJSONFlagLong, MSyntax::kString);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.makeFlagMultiUse(RemoveJSONFlag);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(MessageBusFlag, MessageBusFlagLong, MSyntax::kBoolean);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(RemoveAllFlag, RemoveAllFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(JSONEndpointFlag, JSONEndpointFlagLong, MSyntax::kString);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		auto& StreamManager = FUnrealStreamManager::TheOne();
+
+		TArray<FString> Destinations;
+		StreamManager.GetLiveLinkDestinations(Destinations);
+
+		if (ArgData.isQuery())
+		{
+			if (ArgData.isFlagSet(JSONEndpointFlag))
+			{
+				setResult(MString(TCHAR_TO_UTF8(*StreamManager.GetJSONEndpoint().ToString())));
+			}
+			else if (ArgData.isFlagSet(MessageBusFlag))
+			{
+				setResult(Destinations.Contains(LiveLinkSourceNames[LiveLinkSource::MessageBus]));
+			}
+			else
+			{
+				MStringArray Results;
+				for (const FString& Destination : Destinations)
+				{
+					Results.append(TCHAR_TO_UTF8(*Destination));
+				}
+				setResult(Results);
+			}
+			return MS::kSuccess;
+		}
+
+		bool bChanged = false;
+		if (ArgData.isFlagSet(RemoveAllFlag))
+		{
+			bChanged = Destinations.Num() > 0;
+			StreamManager.RemoveAllLiveLinkDestinations();
+		}
+
+		if (ArgData.isFlagSet(JSONEndpointFlag))
+		{
+			MString Endpoint;
+			ArgData.getFlagArgument(JSONEndpointFlag, 0, Endpoint);
+
+			FIPv4Endpoint JSONEndpoint;
+			if (!FIPv4Endpoint::Parse(Endpoint.asUTF8(), JSONEndpoint))
+			{
+				displayError(MString("Invalid endpoint ") + Endpoint);
+				return MS::kFailure;
+			}
+			bChanged |= StreamManager.SetJSONEndpoint(JSONEndpoint);
+		}
+
+		if (ArgData.isFlagSet(MessageBusFlag))
+		{
+			bool bMessageBus = false;
+			ArgData.getFlagArgument(MessageBusFlag, 0, bMessageBus);
+			bChanged |= bMessageBus ? StreamManager.AddLiveLinkDestination(LiveLinkSource::MessageBus)
+									: StreamManager.RemoveLiveLinkDestination(LiveLinkSource::MessageBus);
+		}
+
+		for (unsigned int i = 0; i < ArgData.numberOfFlagUses(RemoveJSONFlag); ++i)
+		{
+			MArgList FlagArgs;
+			ArgData.getFlagArgumentList(RemoveJSONFlag, i, FlagArgs);
+			bChanged |= StreamManager.RemoveLiveLinkDestination(LiveLinkSource::JSON, FlagArgs.asString(0).asUTF8());
+		}
+
+		for (unsigned int i = 0; i < ArgData.numberOfFlagUses(AddJSONFlag); ++i)
+		{
+			MArgList FlagArgs;
+			ArgData.getFlagArgumentList(AddJSONFlag, i, FlagArgs);
+			const MString Endpoint = FlagArgs.asString(0);
+			if (!StreamManager.AddLiveLinkDestination(LiveLinkSource::JSON, Endpoint.asUTF8()))
+			{
+				displayError(MString("Invalid endpoint ") + Endpoint);
+				return MS::kFailure;
+			}
+			bChanged = true;
+		}
+
+		// New receivers need the static data of every subject
+		if (bChanged)
+		{
+			MayaLiveLinkStreamManager::TheOne().RebuildSubjects();
+		}
+
+		if (bChanged || ArgData.isFlagSet(JSONEndpointFlag))
+		{
+			SaveSettingPreferences("destinations");
+		}
+
+		setResult(bChanged);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkDestinationsCommand::CommandName[];
+constexpr char LiveLinkDestinationsCommand::AddJSONFlag[];
+constexpr char LiveLinkDestinationsCommand::AddJSONFlagLong[];
+constexpr char LiveLinkDestinationsCommand::RemoveJSONFlag[];
+constexpr char LiveLinkDestinationsCommand::RemoveJSONFlagLong[];
+constexpr char LiveLinkDestinationsCommand::MessageBusFlag[];
+constexpr char LiveLinkDestinationsCommand::MessageBusFlagLong[];
+constexpr char LiveLinkDestinationsCommand::RemoveAllFlag[];
+constexpr char LiveLinkDestinationsCommand::RemoveAllFlagLong[];
+constexpr char LiveLinkDestinationsCommand::JSONEndpointFlag[];
+constexpr char LiveLinkDestinationsCommand::JSONEndpointFlagLong[];
+
+class LiveLinkProfilingStatsCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkProfilingStats";
+
+	static constexpr char ResetFlag[] = "r";
+	static constexpr char ResetFlagLong[] = "reset";
+	static constexpr char SubjectsFlag[] = "s";
+	static constexpr char SubjectsFlagLong[] = "subjects";
+	static constexpr char ProviderNameFlag[] = "pn";
+	static constexpr char ProviderNameFlagLong[] = "providerName";
+	static constexpr char DropMessagesFlag[] = "dm";
+	static constexpr char DropMessagesFlagLong[] = "dropMessages";
+
+	static void* Creator() { return new LiveLinkProfilingStatsCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Status = Syntax.addFlag(ResetFlag, ResetFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(SubjectsFlag, SubjectsFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(ProviderNameFlag, ProviderNameFlagLong);
+		CHECK_MSTATUS(Status);
+		Status = Syntax.addFlag(DropMessagesFlag, DropMessagesFlagLong, MSyntax::kBoolean);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		auto LiveLinkProvider = FUnrealStreamManager::TheOne().GetLiveLinkProvider();
+		if (!LiveLinkProvider.IsValid() || LiveLinkProvider->GetSourceType() != LiveLinkSource::Profiling)
+		{
+			MString ErrorMsg;
+			ErrorMsg.format("The ^1s source must be selected", LiveLinkSourceNames[LiveLinkSource::Profiling]);
+			displayError(ErrorMsg);
+			return MS::kFailure;
+		}
+
+		auto ProfilingProvider = StaticCastSharedPtr<FProfilingLiveLinkProducer>(LiveLinkProvider);
+
+		// Simulate an editor that can't be reached, the sends fail until the messages aren't dropped anymore
+		if (ArgData.isFlagSet(DropMessagesFlag))
+		{
+			bool bDropMessages = false;
+			ArgData.getFlagArgument(DropMessagesFlag, 0, bDropMessages);
+			ProfilingProvider->SetDropMessages(bDropMessages);
+			return MS::kSuccess;
+		}
+
+		if (ArgData.isFlagSet(ProviderNameFlag))
+		{
+			setResult(MString(TCHAR_TO_UTF8(*ProfilingProvider->GetProviderName())));
+			return MS::kSuccess;
+		}
+
+		MStringArray Results;
+		if (ArgData.isFlagSet(SubjectsFlag))
+		{
+			// One entry per subject: subject frameMessages
+			for (const auto& SubjectFrameMessages : ProfilingProvider->GetSubjectFrameMessages())
+			{
+				MString Result;
+				Result.format("^1s ^2s",
+							  TCHAR_TO_UTF8(*SubjectFrameMessages.Key.ToString()),
+							  MString() + static_cast<double>(SubjectFrameMessages.Value));
+				Results.append(Result);
+			}
+		}
+		else
+		{
+			// One entry per role: role staticMessages frameMessages bytes allocations encodeMs payloadAllocations
+			for (const auto& RoleStats : ProfilingProvider->GetStats())
+			{
+				const auto& Stats = RoleStats.Value;
+				MString Result;
+				Result.format("^1s ^2s ^3s ^4s ^5s ^6s ^7s",
+							  TCHAR_TO_UTF8(*RoleStats.Key.ToString()),
+							  MString() + static_cast<double>(Stats.StaticDataMessages),
+							  MString() + static_cast<double>(Stats.FrameDataMessages),
+							  MString() + static_cast<double>(Stats.Bytes),
+							  MString() + static_cast<double>(Stats.Allocations),
+							  MString() + Stats.EncodeSeconds * 1000.0,
+							  MString() + static_cast<double>(Stats.PayloadAllocations));
+				Results.append(Result);
+			}
+		}
+
+		if (ArgData.isFlagSet(ResetFlag))
+		{
+			ProfilingProvider->ResetStats();
+		}
+
+		setResult(Results);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkProfilingStatsCommand::CommandName[];
+constexpr char LiveLinkProfilingStatsCommand::ResetFlag[];
+constexpr char LiveLinkProfilingStatsCommand::ResetFlagLong[];
+constexpr char LiveLinkProfilingStatsCommand::SubjectsFlag[];
+constexpr char LiveLinkProfilingStatsCommand::SubjectsFlagLong[];
+constexpr char LiveLinkProfilingStatsCommand::ProviderNameFlag[];
+constexpr char LiveLinkProfilingStatsCommand::ProviderNameFlagLong[];
+constexpr char LiveLinkProfilingStatsCommand::DropMessagesFlag[];
+constexpr char LiveLinkProfilingStatsCommand::DropMessagesFlagLong[];
+
+class LiveLinkCallbackStatsCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkCallbackStats";
+
+	static void* Creator() { return new LiveLinkCallbackStatsCommand(); }
+
+	MStatus doIt(const MArgList& args) override
+	{
+		// One entry per role: role subjects callbacks registrationMs
+		MStringArray Results;
+		MayaLiveLinkStreamManager::TheOne().GetSubjectCallbackStats(Results);
+		setResult(Results);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkCallbackStatsCommand::CommandName[];
+
+class LiveLinkDagChangeStatsCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkDagChangeStats";
+
+	static void* Creator() { return new LiveLinkDagChangeStatsCommand(); }
+
+	MStatus doIt(const MArgList& args) override
+	{
+		// Reparent messages received and the number of batches they were processed in
+		appendToResult(static_cast<int>(NumDagChangeMessages));
+		appendToResult(static_cast<int>(NumDagChangeBatches));
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkDagChangeStatsCommand::CommandName[];
+
+class LiveLinkAnimSequenceLayoutCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkAnimSequenceLayout";
+
+	static constexpr char TrackMajorFlag[] = "tm";
+	static constexpr char TrackMajorFlagLong[] = "trackMajor";
+
+	static void* Creator() { return new LiveLinkAnimSequenceLayoutCommand(); }
+
+	static MSyntax CreateSyntax()
+	{
+		MStatus Status;
+		MSyntax Syntax;
+
+		Syntax.enableQuery(true);
+
+		Status = Syntax.addFlag(TrackMajorFlag, TrackMajorFlagLong, MSyntax::kBoolean);
+		CHECK_MSTATUS(Status);
+
+		return Syntax;
+	}
+
+	MStatus doIt(const MArgList& args) override
+	{
+		MStatus Status;
+		MArgDatabase ArgData(syntax(), args, &Status);
+		CHECK_MSTATUS_AND_RETURN_IT(Status);
+
+		auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+
+		if (ArgData.isQuery() || !ArgData.isFlagSet(TrackMajorFlag))
+		{
+			setResult(StreamManager.IsAnimSequenceTrackLayout());
+			return MS::kSuccess;
+		}
+
+		bool bTrackMajor = false;
+		ArgData.getFlagArgument(TrackMajorFlag, 0, bTrackMajor);
+		StreamManager.SetAnimSequenceTrackLayout(bTrackMajor);
+		SaveSettingPreferences("animSequenceLayout");
+
+		setResult(bTrackMajor);
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkAnimSequenceLayoutCommand::CommandName[];
+constexpr char LiveLinkAnimSequenceLayoutCommand::TrackMajorFlag[];
+constexpr char LiveLinkAnimSequenceLayoutCommand::TrackMajorFlagLong[];
+
+class LiveLinkUnrealFootprintCommand : public MPxCommand
+{
+public:
+	static constexpr char CommandName[] = "LiveLinkUnrealFootprint";
+
+	static void* Creator() { return new LiveLinkUnrealFootprintCommand(); }
+
+	MStatus doIt(const MArgList& args) override
+	{
+		uint64 ResidentBytes = 0;
+		uint64 ResidentBytesBeforeInit = 0;
+		int32 NumThreads = 0;
+		UnrealInitializer::TheOne().GetFootprint(ResidentBytes, ResidentBytesBeforeInit, NumThreads);
+
+		// residentMB residentMBBeforeUnreal unrealThreads
+		appendToResult(ResidentBytes / (1024.0 * 1024.0));
+		appendToResult(ResidentBytesBeforeInit / (1024.0 * 1024.0));
+		appendToResult(static_cast<double>(NumThreads));
+		return MS::kSuccess;
+	}
+};
+constexpr char LiveLinkUnrealFootprintCommand::CommandName[];
+
+void OnMayaExit(void* client)
+{
+	MayaLiveLinkStreamManager::TheOne().ClearSubjects();
+}
+
+void OnScenePreOpen(void* Client)
+{
+	// The panels are rebuilt with the scene, register them again once it's loaded
+	ClearViewportCallbacks();
+	QueueViewportCallbacksRefresh();
+	MayaLiveLinkStreamManager::TheOne().Reset();
+	MSceneDeformerIndex::TheOne().Reset();
+	MayaUnrealLiveLinkUtils::RefreshUI();
+}
+
+void OnScenePreNew(void* Client)
+{
+	OnScenePreOpen(Client);
+}
+
+void OnSceneOpen(void* Client)
+{
+	MGlobal::executeCommandOnIdle("MayaUnrealLiveLinkOnSceneOpen");
+}
+
+bool CameraManipStarted = false;
+bool AnimCurveEdited = false;
+bool AnimKeyFrameEdited = false;
+MTime::Unit CurrentTimeUnit = MTime::kInvalid;
+bool gTimeChangedReceived = false;
+FQualifiedFrameTime TimeReceived;
+std::atomic<bool> SendUpdatedData {false};
+std::atomic<bool> IsManipulationComplete { false };
+std::chrono::steady_clock::time_point LastSendTime;
+const int MinTimeIntervalMs = 50;
+
+// Helper method to send data to unreal when SendUpdatedData is set.
+void StreamDataToUnreal()
+{
+	if (!LiveLinkObjectTransformSyncCommand::IsEnabled() && !SendUpdatedData) 
+	{
+		return;
+	}
+
+	if (gTimeChangedReceived)
+	{
+		gTimeChangedReceived = false;
+		return;
+	}
+
+	auto Now = std::chrono::high_resolution_clock::now();
+	auto TimeElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Now - LastSendTime).count();
+	
+	if(!SendUpdatedData && TimeElapsed < MinTimeIntervalMs && !IsManipulationComplete)
+		return;
+
+	IsManipulationComplete = false;
+	LastSendTime = Now;
+
+	auto& StreamManager = MayaLiveLinkStreamManager::TheOne();
+	auto TimeUnit = MAnimControl::currentTime().unit();
+	if (TimeUnit != CurrentTimeUnit)
+	{
+		CurrentTimeUnit = TimeUnit;
+		StreamManager.OnTimeUnitChanged();
+	}
+
+	if (!CameraManipStarted && !AnimCurveEdited && !AnimKeyFrameEdited)
+	{
+		auto LiveLinkProvider = FUnrealStreamManager::TheOne().GetLiveLinkProvider();
+		if (LiveLinkPlayheadSyncCommand::IsEnabled() &&
+			LiveLinkProvider.IsValid() &&
+			LiveLinkProvider->HasConnection())
+		{
+			LiveLinkProvider->OnTimeChanged(MayaUnrealLiveLinkUtils::GetMayaFrameTimeAsUnrealTime());
+
+			// Need to sleep the thread so that the OnTimeChanged message is sent to Unreal
+			using namespace std::chrono_literals;
+			std::this_thread::sleep_for(20ms);
+		}
+
+		// During playback the upcoming frames are sent ahead so that the editor can buffer them
+		if (!StreamManager.StreamPlaybackLookAhead(MAnimControl::isPlaying()))
+		{
+			StreamManager.StreamSubjects();
+		}
+	}
+	else
+	{
+		if (!AnimCurveEdited)
+		{
+			// If anim curve edited was clear, we can then clear the anim key framed edited flag
+			// That's because Maya sends 2 OnTimeChanged events that we want to ignore.
+			AnimKeyFrameEdited = false;
+		}
+		else
+		{
+			AnimCurveEdited = false;
+		}
+	}
+
+	// Set the streaming flag to false.
+	SendUpdatedData = false;
+}
+
+void StreamOnIdleTask(void* ClientData)
+{
+	// The client data points in the subject list which is cleared when shutting down
+	if (!ClientData || PluginShuttingDown)
+	{
+		return;
+	}
+
+	IsManipulationComplete = true;
+
+	// In some situations (such as manipulating an HIK Effector in Full Body mode), a lot of Attributes can be
+	// changing at once, and each of those attribute changes registers for an Idle callback. This results in 
+	// lots of sends for the same Subject at one time. This map protects against that by not sending it again
+	// for the same Subject if we sent very recently.
+	static std::unordered_map<void*, double> s_mostRecentSends;
+	double StreamTime = FPlatformTime::Seconds();
+
+	std::shared_ptr<IMStreamedEntity> Subject = *static_cast<std::shared_ptr<IMStreamedEntity>*>(ClientData);
+
+	auto it = s_mostRecentSends.find(ClientData);
+	if (it != s_mostRecentSends.end())
+	{
+		if (StreamTime - it->second < (1.0 / static_cast<double>(MinTimeIntervalMs)))
+			return;
+	}
+
+	auto FrameNumber = MAnimControl::currentTime().value();
+	Subject->OnStream(StreamTime, FrameNumber);
+
+	s_mostRecentSends[ClientData] = StreamTime;
+}
+
+void StreamOnIdle(std::shared_ptr<IMStreamedEntity>& Subject, MGlobal::MIdleTaskPriority Priority)
+{
+	MGlobal::executeTaskOnIdle(StreamOnIdleTask, &Subject, Priority);
+}
+
+void OnTimeChanged(MTime& Time, void* ClientData)
+{
+	SendUpdatedData = true;
+	AnimCurveEdited  = false;
+	AnimKeyFrameEdited = false;
+}
+
+int FindMatchingDagPath(const MString& DagPathName, const MFnDagNode& DagNode, const MStringArray& SubjectPaths, MDagPath& SubjectDagPath)
+{
+	int PathIndex = -1;
+	const auto SubjectPathLen = SubjectPaths.length();
+	for (unsigned int path = 0; path < SubjectPathLen; ++path)
+	{
+		const MString& SubjectPath = SubjectPaths[path];
+
+		MSelectionList SelectionList;
+		SelectionList.add(SubjectPath);
+		MObject SubjectObj;
+		SelectionList.getDependNode(0, SubjectObj);
+		SelectionList.getDagPath(0, SubjectDagPath);
+
+		if (SubjectPath == DagPathName)
+		{
+			PathIndex = path;
+			break;
+		}
+		else
+		{
+			MDagPath ShapeDagPath = SubjectDagPath;
+			ShapeDagPath.extendToShape();
+			if (ShapeDagPath.fullPathName() == DagPathName)
+			{
+				PathIndex = path;
+				break;
+			}
+			else if (PathIndex == -1 && DagNode.isChildOf(SubjectObj))
+			{
+				PathIndex = path;
+			}
+		}
+	}
+
+	return PathIndex;
+}
+
+bool FindNodeAffectedByConstraint(const MObject& Node, const MStringArray& SubjectPaths, MObject& NodeWithConstraint)
+{
+	MFnDependencyNode DependNode(Node);
+	MObject Constraint;
+	MPlug ParentMatrixPlugArray = DependNode.findPlug("parentMatrix", false);
+	if (!ParentMatrixPlugArray.isNull() && ParentMatrixPlugArray.isArray())
+	{
+		const unsigned int SubjectPathLen = SubjectPaths.length();
+		for (unsigned int ParentMatrixIndex = 0; ParentMatrixIndex < ParentMatrixPlugArray.numElements(); ++ParentMatrixIndex)
+		{
+			MPlug DependPlug = ParentMatrixPlugArray[ParentMatrixIndex];
+			MPlugArray DependConnections;
+			DependPlug.connectedTo(DependConnections, false, true);
+			for (unsigned int DependIdx = 0; DependIdx < DependConnections.length(); ++DependIdx)
+			{
+				MPlug DependConnection = DependConnections[DependIdx];
+				MObject DependObject = DependConnection.node();
+				if (DependObject.hasFn(MFn::kConstraint))
+				{
+					for (unsigned int path = 0; path < SubjectPathLen; ++path)
+					{
+						const MString& SubjectPath = SubjectPaths[path];
+
+						MSelectionList SelectionList;
+						SelectionList.add(SubjectPath);
+						MDagPath SubjectDagPath;
+						MObject SubjectObj;
+						SelectionList.getDependNode(0, SubjectObj);
 						SelectionList.getDagPath(0, SubjectDagPath);
 						MFnDagNode DagNode(SubjectDagPath);
 						if (DagNode.isParentOf(DependObject))
@@ -2267,6 +3161,12 @@ void OnAnimKeyframeEdited(MObjectArray& Objects, void* ClientData)
 
 void ChangeTime(void* ClientData)
 {
+	if (PluginShuttingDown)
+	{
+		ChangeTimeDone = true;
+		return;
+	}
+
 	gTimeChangedReceived = true;
 
 	FFrameRate MayaFrameRate = MayaUnrealLiveLinkUtils::GetMayaFrameRateAsUnrealFrameRate();
@@ -2286,7 +3186,7 @@ void ChangeTime(void* ClientData)
 
 void OnTimeChangedReceived(const FQualifiedFrameTime& Time)
 {
-	if (!LiveLinkPlayheadSyncCommand::IsEnabled())
+	if (PluginShuttingDown || !LiveLinkPlayheadSyncCommand::IsEnabled())
 	{
 		return;
 	}
@@ -2354,11 +3254,15 @@ void OnCameraEndManip(MObject& Node, void* ClientData)
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-std::map<uintptr_t, MCallbackId> PostRenderCallbackIds;
-std::map<uintptr_t, MCallbackId> ViewportDeletedCallbackIds;
-std::map<uintptr_t, MCallbackId> CameraBeginManipCallbackIds;
-std::map<uintptr_t, MCallbackId> CameraEndManipCallbackIds;
-std::map<uintptr_t, MCallbackId> CameraChangedCallbackIds;
+// Callbacks registered on a model panel, keyed by the panel's full path name
+struct MViewportCallbacks
+{
+	MCallbackIdArray PanelCallbackIds;
+	MCallbackIdArray CameraCallbackIds;
+	MDagPath CameraDagPath;
+};
+std::map<std::string, MViewportCallbacks> ViewportCallbacks;
+bool ViewportCallbacksRefreshQueued = false;
 
 void OnPostRenderViewport(const MString &str, void* ClientData)
 {
@@ -2384,141 +3288,181 @@ void OnPostRenderViewport(const MString &str, void* ClientData)
 	StreamDataToUnreal();
 }
 
+void RefreshViewportCallbacksOnIdle(void* ClientData)
+{
+	ViewportCallbacksRefreshQueued = false;
+	if (!PluginShuttingDown)
+	{
+		RefreshViewportCallbacks();
+	}
+}
+
+// Panels are created, deleted and assigned to cameras in bursts, only refresh once on the next idle
+void QueueViewportCallbacksRefresh()
+{
+	if (!ViewportCallbacksRefreshQueued)
+	{
+		ViewportCallbacksRefreshQueued = true;
+		MGlobal::executeTaskOnIdle(RefreshViewportCallbacksOnIdle, nullptr, MGlobal::kHighIdlePriority);
+	}
+}
+
 void OnCameraChanged(const MString& String, MObject& Node, void* ClientData)
 {
-	ClearViewportCallbacks();
-	RefreshViewportCallbacks();
+	QueueViewportCallbacksRefresh();
 }
 
 void OnViewportClosed(void* ClientData)
 {
-	uintptr_t ViewIndex = reinterpret_cast<uintptr_t>(ClientData);
+	QueueViewportCallbacksRefresh();
+}
 
-	auto removeCallback = [ViewIndex](std::map<uintptr_t, MCallbackId>& CallbackIds)
-	{
-		MMessage::removeCallback(CallbackIds[ViewIndex]);
-		CallbackIds.erase(ViewIndex);
-	};
+void OnSelectionChanged(void* ClientData)
+{
+	MayaLiveLinkStreamManager::TheOne().InvalidateSelectedSubjects();
+}
 
-	if (CameraBeginManipCallbackIds.size() == PostRenderCallbackIds.size())
-	{
-		removeCallback(CameraBeginManipCallbackIds);
-	}
-	if (CameraEndManipCallbackIds.size() == PostRenderCallbackIds.size())
-	{
-		removeCallback(CameraEndManipCallbackIds);
-	}
+void OnModelPanelEvent(void* ClientData)
+{
+	QueueViewportCallbacksRefresh();
+}
 
-	removeCallback(PostRenderCallbackIds);
-	removeCallback(ViewportDeletedCallbackIds);
-	removeCallback(CameraChangedCallbackIds);
+void RemoveViewportCallbacks(MViewportCallbacks& Callbacks)
+{
+	MMessage::removeCallbacks(Callbacks.PanelCallbackIds);
+	MMessage::removeCallbacks(Callbacks.CameraCallbackIds);
+	Callbacks.PanelCallbackIds.clear();
+	Callbacks.CameraCallbackIds.clear();
+	Callbacks.CameraDagPath = MDagPath();
 }
 
 void ClearViewportCallbacks()
 {
-	auto removeCallbacks = [](std::map<uintptr_t, MCallbackId>& CallbackIds)
+	for (auto& Pair : ViewportCallbacks)
 	{
-		for (std::pair<const uintptr_t, MCallbackId>& Pair : CallbackIds)
-		{
-			MMessage::removeCallback(Pair.second);
-		}
-		CallbackIds.clear();
-	};
-
-	removeCallbacks(PostRenderCallbackIds);
-	removeCallbacks(ViewportDeletedCallbackIds);
-	removeCallbacks(CameraBeginManipCallbackIds);
-	removeCallbacks(CameraEndManipCallbackIds);
-	removeCallbacks(CameraChangedCallbackIds);
+		RemoveViewportCallbacks(Pair.second);
+	}
+	ViewportCallbacks.clear();
 }
 
-MStatus RefreshViewportCallbacks()
+MStatus RegisterViewportCallbacks(const MString& EditorPanelPath, MViewportCallbacks& Callbacks)
 {
 	MStatus ExitStatus;
 
-	if (M3dView::numberOf3dViews() != PostRenderCallbackIds.size())
+	MString EditorPanel = EditorPanelPath;
+	int LastIndex = EditorPanel.rindex('|');
+	if (LastIndex >= 0)
 	{
-		ClearViewportCallbacks();
+		EditorPanel = EditorPanel.substring(LastIndex + 1, EditorPanel.length());
+	}
 
-		static MString ListEditorPanelsCmd = "gpuCacheListModelEditorPanels";
+	M3dView View;
+	const bool bHasView = M3dView::getM3dViewFromModelPanel(EditorPanel, View);
+
+	if (Callbacks.PanelCallbackIds.length() == 0)
+	{
+		MStatus Status;
+		MCallbackId CallbackId = MUiMessage::add3dViewPostRenderMsgCallback(EditorPanelPath, OnPostRenderViewport, NULL, &Status);
+		MREPORTERROR(Status, "MUiMessage::add3dViewPostRenderMsgCallback()");
+		if (Status != MStatus::kSuccess)
+		{
+			return MStatus::kFailure;
+		}
+		Callbacks.PanelCallbackIds.append(CallbackId);
 
-		MStringArray EditorPanels;
-		ExitStatus = MGlobal::executeCommand(ListEditorPanelsCmd, EditorPanels);
-		MCHECKERROR(ExitStatus, "gpuCacheListModelEditorPanels");
+		CallbackId = MUiMessage::addUiDeletedCallback(EditorPanelPath, OnViewportClosed, nullptr, &Status);
+		MREPORTERROR(Status, "MUiMessage::addUiDeletedCallback()");
+		if (Status == MStatus::kSuccess)
+		{
+			Callbacks.PanelCallbackIds.append(CallbackId);
+		}
+		else
+		{
+			ExitStatus = MStatus::kFailure;
+		}
 
-		if (ExitStatus == MStatus::kSuccess)
+		if (bHasView)
 		{
-			for (uintptr_t i = 0; i < EditorPanels.length(); ++i)
+			// Callback to detect when a viewport gets assign to a new camera
+			CallbackId = MUiMessage::addCameraChangedCallback(EditorPanel, OnCameraChanged, nullptr, &Status);
+			if (Status == MStatus::kSuccess)
+			{
+				Callbacks.PanelCallbackIds.append(CallbackId);
+			}
+			else
 			{
-				MStatus Status;
-				MCallbackId CallbackId = MUiMessage::add3dViewPostRenderMsgCallback(EditorPanels[i], OnPostRenderViewport, NULL, &Status);
+				ExitStatus = MStatus::kFailure;
+			}
+		}
+	}
 
-				MREPORTERROR(Status, "MUiMessage::add3dViewPostRenderMsgCallback()");
+	// Only the manipulation callbacks of the camera the panel is looking through are needed
+	MDagPath CameraDagPath;
+	if (!bHasView || !View.getCamera(CameraDagPath) || CameraDagPath == Callbacks.CameraDagPath)
+	{
+		return ExitStatus;
+	}
 
-				if (Status != MStatus::kSuccess)
-				{
-					ExitStatus = MStatus::kFailure;
-					continue;
-				}
+	MMessage::removeCallbacks(Callbacks.CameraCallbackIds);
+	Callbacks.CameraCallbackIds.clear();
+	Callbacks.CameraDagPath = MDagPath();
 
-				PostRenderCallbackIds.emplace(i, CallbackId);
+	MStatus Status;
+	MFnCamera Camera(CameraDagPath, &Status);
+	if (!Status)
+	{
+		return ExitStatus;
+	}
 
-				M3dView View;
-				MString EditorPanel = EditorPanels[i];
-				int LastIndex = EditorPanel.rindex('|');
-				if (LastIndex >= 0)
-				{
-					EditorPanel = EditorPanel.substring(LastIndex + 1, EditorPanel.length());
-				}
-				if (M3dView::getM3dViewFromModelPanel(EditorPanel, View))
-				{
-					// Callback to detect when a viewport gets assign to a new camera
-					CallbackId = MUiMessage::addCameraChangedCallback(EditorPanel, OnCameraChanged, nullptr, &Status);
-					if (Status != MStatus::kSuccess)
-					{
-						ExitStatus = MStatus::kFailure;
-						continue;
-					}
-					CameraChangedCallbackIds.emplace(i, CallbackId);
+	MCallbackId CallbackId = MCameraMessage::addBeginManipulationCallback(Camera.object(), OnCameraBeginManip, nullptr, &Status);
+	MREPORTERROR(Status, "MCameraMessage::addBeginManipulationCallback()");
+	if (Status != MStatus::kSuccess)
+	{
+		return MStatus::kFailure;
+	}
+	Callbacks.CameraCallbackIds.append(CallbackId);
 
-					MDagPath CameraDagPath;
-					if (View.getCamera(CameraDagPath))
-					{
-						MFnCamera Camera(CameraDagPath, &Status);
-						if (Status)
-						{
-							CallbackId = MCameraMessage::addBeginManipulationCallback(Camera.object(), OnCameraBeginManip, nullptr, &Status);
-							MREPORTERROR(Status, "MCameraMessage::addBeginManipulationCallback()");
-							if (Status != MStatus::kSuccess)
-							{
-								ExitStatus = MStatus::kFailure;
-								continue;
-							}
-							CameraBeginManipCallbackIds.emplace(i, CallbackId);
+	CallbackId = MCameraMessage::addEndManipulationCallback(Camera.object(), OnCameraEndManip, nullptr, &Status);
+	MREPORTERROR(Status, "MCameraMessage::addEndManipulationCallback()");
+	if (Status != MStatus::kSuccess)
+	{
+		return MStatus::kFailure;
+	}
+	Callbacks.CameraCallbackIds.append(CallbackId);
+	Callbacks.CameraDagPath = CameraDagPath;
 
-							CallbackId = MCameraMessage::addEndManipulationCallback(Camera.object(), OnCameraEndManip, nullptr, &Status);
-							MREPORTERROR(Status, "MCameraMessage::addEndManipulationCallback()");
-							if (Status != MStatus::kSuccess)
-							{
-								ExitStatus = MStatus::kFailure;
-								continue;
-							}
-							CameraEndManipCallbackIds.emplace(i, CallbackId);
-						}
-					}
-				}
+	return ExitStatus;
+}
+
+MStatus RefreshViewportCallbacks()
+{
+	static MString ListEditorPanelsCmd = "gpuCacheListModelEditorPanels";
 
-				CallbackId = MUiMessage::addUiDeletedCallback(EditorPanels[i], OnViewportClosed, reinterpret_cast<void*>(i), &Status);
+	MStringArray EditorPanels;
+	MStatus ExitStatus = MGlobal::executeCommand(ListEditorPanelsCmd, EditorPanels);
+	MCHECKERROR(ExitStatus, "gpuCacheListModelEditorPanels");
 
-				MREPORTERROR(Status, "MUiMessage::addUiDeletedCallback()");
+	// Forget the panels that were deleted
+	for (auto It = ViewportCallbacks.begin(); It != ViewportCallbacks.end();)
+	{
+		if (EditorPanels.indexOf(MString(It->first.c_str())) < 0)
+		{
+			RemoveViewportCallbacks(It->second);
+			It = ViewportCallbacks.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
 
-				if (Status != MStatus::kSuccess)
-				{
-					ExitStatus = MStatus::kFailure;
-					continue;
-				}
-				ViewportDeletedCallbackIds.emplace(i, CallbackId);
-			}
+	// Register the new panels and follow the camera changes of the existing ones
+	for (unsigned int i = 0; i < EditorPanels.length(); ++i)
+	{
+		MViewportCallbacks& Callbacks = ViewportCallbacks[EditorPanels[i].asChar()];
+		if (RegisterViewportCallbacks(EditorPanels[i], Callbacks) != MStatus::kSuccess)
+		{
+			ExitStatus = MStatus::kFailure;
 		}
 	}
 
@@ -2529,72 +3473,55 @@ MStatus RefreshViewportCallbacks()
 
 void OnInterval(float ElapsedTime, float LastTime, void* ClientData)
 {
-	//No good way to check for new views being created, so just periodically refresh our list
-	RefreshViewportCallbacks();
-
 	OnConnectionStatusChanged();
 
 	FTickerTick(ElapsedTime);
 }
 
-std::atomic<std::chrono::time_point<std::chrono::steady_clock>> PlaybackRangeChangedId;
-std::atomic<bool> PlaybackRangeThreadStarted(false);
-TUniquePtr<class FDetectIdleEvent> DetectIdleEvent = nullptr;
+std::chrono::steady_clock::time_point PlaybackRangeChangedTime;
+MCallbackId PlaybackRangeTimerCallbackId = 0;
+bool PlaybackRangeTimerRegistered = false;
 
-class FDetectIdleEvent : public FRunnable
+void RemovePlaybackRangeTimer()
 {
-public:
-	FDetectIdleEvent();
-
-	virtual ~FDetectIdleEvent();
-
-	virtual bool Init() override { return true; }
-	uint32 Run() override;
-	void Stop() override;
-
-private:
-	FRunnableThread* Thread;
-	bool bRunThread;
-};
-
-FDetectIdleEvent::FDetectIdleEvent()
-: bRunThread(true)
-{
-	Thread = FRunnableThread::Create(this, TEXT("DetectIdleEvent"));
+	if (PlaybackRangeTimerRegistered)
+	{
+		MMessage::removeCallback(PlaybackRangeTimerCallbackId);
+		PlaybackRangeTimerRegistered = false;
+	}
 }
 
-FDetectIdleEvent::~FDetectIdleEvent()
+void RebuildLinkedStreamSubjects()
 {
-	if (Thread)
+	auto& LiveLinkStreamManager = MayaLiveLinkStreamManager::TheOne();
+	if (PreviousConnectionStatus && LiveLinkStreamManager.RebuildLinkedSubjects())
 	{
-		Thread->Kill();
-		delete Thread;
+		// Wait a bit after rebuilding the subject data before sending the curve data to Unreal.
+		// Otherwise, Unreal will ignore it.
+		using namespace std::chrono_literals;
+		std::this_thread::sleep_for(100ms);
+
+		LiveLinkStreamManager.StreamLinkedSubjects();
 	}
 }
 
-uint32 FDetectIdleEvent::Run()
+void CheckPlaybackRangeRebake()
 {
-	using namespace std::chrono_literals;
-
-	// Pause the thread until we're sure that no other playback range change occurs
-	while (std::chrono::duration<double>(std::chrono::steady_clock::now() - PlaybackRangeChangedId.load()).count() < 2.0 &&
-		   bRunThread)
+	// Wait until we're sure that no other playback range change occurs
+	if (!PlaybackRangeTimerRegistered ||
+		std::chrono::duration<double>(std::chrono::steady_clock::now() - PlaybackRangeChangedTime).count() < PlaybackRangeQuietPeriod)
 	{
-		FPlatformProcess::Sleep(0.01);
+		return;
 	}
 
-	// Rebuild the subjects
-	MGlobal::executeTaskOnIdle(RebuildStreamSubjects, nullptr, MGlobal::kHighIdlePriority);
-
-	// End the thread
-	PlaybackRangeThreadStarted.store(false);
-
-	return 0;
+	RemovePlaybackRangeTimer();
+	++NumPlaybackRangeRebakes;
+	RebuildLinkedStreamSubjects();
 }
 
-void FDetectIdleEvent::Stop()
+void OnPlaybackRangeTimer(float ElapsedTime, float LastTime, void* ClientData)
 {
-	bRunThread = false;
+	CheckPlaybackRangeRebake();
 }
 
 void OnPlaybackRangeChanged(void* ClientData)
@@ -2604,25 +3531,16 @@ void OnPlaybackRangeChanged(void* ClientData)
 		return;
 	}
 
-	// On playback range changed, we are starting a worker thread that will wait
-	// to see if another playback range changed happens shortly after.
-	// If it does, the wait timer will be reset.
-	// If it doesn't, we will rebuild the subjects with the new playback range.
-
-	// Update the timer, which will reset how long the thread will wait
-	PlaybackRangeChangedId.store(std::chrono::steady_clock::now());
-	if (!PlaybackRangeThreadStarted.load())
+	// Dragging the range slider sends a burst of changes, each one pushes back the rebuild
+	// of the subjects until the playback range stays the same for the quiet period.
+	PlaybackRangeChangedTime = std::chrono::steady_clock::now();
+	if (!PlaybackRangeTimerRegistered)
 	{
-		if (DetectIdleEvent.IsValid())
-		{
-			DetectIdleEvent->Stop();
-			DetectIdleEvent.Reset();
-		}
-
-		// Start the worker thread that will wait for additional user input before rebuilding the subjects
-		PlaybackRangeThreadStarted.store(true);
-		DetectIdleEvent = MakeUnique<FDetectIdleEvent>();
-		DetectIdleEvent->Init();
+		MStatus Status;
+		const float Period = static_cast<float>(FMath::Max(PlaybackRangeQuietPeriod * 0.25, 0.05));
+		PlaybackRangeTimerCallbackId = MTimerMessage::addTimerCallback(Period, OnPlaybackRangeTimer, nullptr, &Status);
+		MREPORTERROR(Status, "MTimerMessage::addTimerCallback()");
+		PlaybackRangeTimerRegistered = Status == MStatus::kSuccess;
 	}
 }
 
@@ -2638,97 +3556,147 @@ void AfterSaveCallback(void* ClientData)
 	IgnoreAllDagChangesCallback = false;
 }
 
+std::vector<std::pair<MDagPath, MDagPath>> PendingParentsAdded;
+bool DagChangesQueued = false;
+
+void ProcessDagChanges(void* ClientData)
+{
+	DagChangesQueued = false;
+
+	std::vector<std::pair<MDagPath, MDagPath>> ParentsAdded;
+	ParentsAdded.swap(PendingParentsAdded);
+	if (PluginShuttingDown)
+	{
+		return;
+	}
+
+	++NumDagChangeBatches;
+	MayaLiveLinkStreamManager::TheOne().OnParentsAdded(ParentsAdded);
+
+	// Update the UI once for the whole batch to update the dag paths
+	MayaUnrealLiveLinkUtils::RefreshUI();
+}
+
 void AllDagChangesCallback(MDagMessage::DagMessage MsgType,
 						   MDagPath& Child,
 						   MDagPath& Parent,
 						   void* ClientData)
 {
-	// Update the UI when a parent is added/removed to update the dag paths
 	if (!IgnoreAllDagChangesCallback &&
 		(MsgType == MDagMessage::kParentAdded ||
 		 MsgType == MDagMessage::kParentRemoved))
 	{
-		// Verify if we need to register a callback for the new parent
+		// Importing or referencing a file reparents a lot of nodes, accumulate the changes and process them once on idle
+		++NumDagChangeMessages;
+		MayaLiveLinkStreamManager::TheOne().InvalidateSelectedSubjects();
 		if (MsgType == MDagMessage::kParentAdded && Child.isValid() && Parent.isValid() && Parent.length() != 0)
 		{
-			std::vector<IMStreamedEntity*> Subjects;
-			MayaLiveLinkStreamManager::TheOne().GetSubjectsFromParentPath(Child, Subjects);
-
-			MFnDagNode ChildDagNode(Child);
-			for (IMStreamedEntity* Subject : Subjects)
-			{
-				const MDagPath& SubjectPath = Subject->GetDagPath();
-				bool bRegisterNode = SubjectPath == Child;
-				if (!bRegisterNode)
-				{
-					MObject DagNode = SubjectPath.node();
-					bRegisterNode = ChildDagNode.isParentOf(DagNode);
-				}
-				if (bRegisterNode)
-				{
-					MObject ParentObject = Parent.node();
-					Subject->RegisterParentNode(ParentObject);
-				}
-				
-			}
+			PendingParentsAdded.emplace_back(Child, Parent);
 		}
 
-		MayaUnrealLiveLinkUtils::RefreshUI();
+		if (!DagChangesQueued)
+		{
+			DagChangesQueued = true;
+			MGlobal::executeTaskOnIdle(ProcessDagChanges, nullptr, MGlobal::kHighIdlePriority);
+		}
 	}
 }
 
-/**
-* This function is called by Maya when the plugin becomes loaded
-*
-* @param	MayaPluginObject	The Maya object that represents our plugin
-*
-* @return	MS::kSuccess if everything went OK and the plugin is ready to use
-*/
-MStatus initializePlugin(MObject MayaPluginObject)
+void OnDeformerNodeAdded(MObject& Node, void* ClientData)
 {
-	PluginVersion = TCHAR_TO_ANSI(*FMayaLiveLinkInterfaceModule::GetPluginVersion());
+	MSceneDeformerIndex::TheOne().OnNodeAdded(Node);
+}
 
-	// Tell Maya about our plugin
-	MFnPlugin MayaPlugin(
-		MayaPluginObject,
-		"Autodesk, Inc.",
-		PluginVersion.c_str());
+void OnDeformerNodeRemoved(MObject& Node, void* ClientData)
+{
+	MSceneDeformerIndex::TheOne().OnNodeRemoved(Node);
+}
 
-	// Check if another UE version of the plugin is already loaded
-	auto LoadedString = GetEnv(OtherUEVersionLoadedEnvVar);
-	if (LoadedString.empty())
+bool UnrealInitializationCompleted = false;
+MCallbackId UnrealInitializationTimerCallbackId = 0;
+bool UnrealInitializationTimerRegistered = false;
+
+// MEL commands run before Unreal was initialized, along with the selection they were run with
+std::vector<MString> QueuedUnrealCommands;
+
+// Placeholder for a command run before Unreal is initialized. The queued commands only take
+// string arguments, they are run again from MEL once Unreal is initialized.
+class QueuedUntilUnrealCommand : public MPxCommand
+{
+public:
+	QueuedUntilUnrealCommand(const MString& InCommandName)
+	: CommandName(InCommandName)
 	{
-		// Create an environment variable telling that the current plugin is loaded
-		PutEnv(OtherUEVersionLoadedEnvVar, MayaPlugin.name().asChar());
 	}
-	else
+
+	MStatus doIt(const MArgList& Args) override
 	{
-		// We're loading another UE version of the plugin, make sure it's different
-		// If it is, we're going to disable the auto-load for the previous plugin and
-		// activate the auto-load for the current plugin.
-		// We will also quit Maya to completely initialize Unreal.
-		auto PrevPluginName = MString(LoadedString.c_str());
-		if (MayaPlugin.name() != PrevPluginName)
+		auto QuoteMEL = [](MString Value)
 		{
-			MGlobal::displayWarning("Unable to load Unreal 5.x Live Link for Maya plug-in, because the Unreal 4.27 version of the same plug-in is/was already loaded.");
+			Value.substitute("\\", "\\\\");
+			Value.substitute("\"", "\\\"");
+			return MString("\"") + Value + "\"";
+		};
 
-			// Execute the command that will check for the auto-load status, change it for the current plugin and tell the user
-			// that Maya needs to be restarted for the change to take effect.
-			MGlobal::executeCommandOnIdle("MayaLiveLinkNotifyAndQuit \"" + MayaPlugin.name() + "\" \"" + PrevPluginName + "\"", false);
-
-			MayaUnrealLiveLinkUtils::RefreshUI();
+		MString Command = CommandName;
+		for (unsigned int i = 0; i < Args.length(); ++i)
+		{
+			Command += MString(" ") + QuoteMEL(Args.asString(i));
+		}
 
-			// Must return success, otherwise we won't be able to set the autoload flag since Maya throws an exception if the plugin is not loaded
-			return MS::kSuccess;
+		// Run the command with the current selection and restore the selection at that time afterwards
+		MSelectionList Selection;
+		MGlobal::getActiveSelectionList(Selection);
+		MStringArray SelectionStrings;
+		Selection.getSelectionStrings(SelectionStrings);
+		MString SelectCommand = "select -clear;";
+		for (unsigned int i = 0; i < SelectionStrings.length(); ++i)
+		{
+			SelectCommand += MString(" select -add ") + QuoteMEL(SelectionStrings[i]) + ";";
 		}
+		QueuedUnrealCommands.push_back(MString("{ string $liveLinkSelection[] = `ls -selection -long`; ") + SelectCommand + " " + Command +
+									   "; select -clear; if (size($liveLinkSelection) > 0) select -replace $liveLinkSelection; }");
+
+		MGlobal::displayInfo("Unreal is initializing, the command will run once it's initialized");
+
+		// Same result type as the queued commands, nothing was added or changed yet
+		appendToResult(false);
+		return MS::kSuccess;
 	}
 
-	if (UnrealInitializer::TheOne().HasInitializedOnce())
+private:
+	MString CommandName;
+};
+
+// Run the queued commands in order from the idle queue, so that they are echoed and go through the undo queue
+void RunQueuedUnrealCommands()
+{
+	for (const MString& QueuedCommand : QueuedUnrealCommands)
 	{
-		MGlobal::displayWarning("Unreal Live Link plug-in is unable to reload after unloading in same session. Please restart Maya to reload the plug-in again.");
-		const MStatus MayaStatusResult = MS::kFailure;
-		return MayaStatusResult;
+		MGlobal::executeCommandOnIdle(QueuedCommand, true);
+	}
+	QueuedUnrealCommands.clear();
+}
+
+void RemoveUnrealInitializationTimer()
+{
+	if (UnrealInitializationTimerRegistered)
+	{
+		MMessage::removeCallback(UnrealInitializationTimerCallbackId);
+		UnrealInitializationTimerRegistered = false;
+	}
+}
+
+// Finish the initialization once the engine is initialized, running the remaining initialization steps if needed.
+// The callbacks that stream the subjects are only registered once Live Link can be used.
+void CompleteUnrealInitialization()
+{
+	if (UnrealInitializationCompleted)
+	{
+		return;
 	}
+	UnrealInitializationCompleted = true;
+	RemoveUnrealInitializationTimer();
 
 	UnrealInitializer::TheOne().InitializeUnreal();
 	UnrealInitializer::TheOne().AddMayaOutput(PrintInfoToMaya);
@@ -2738,6 +3706,7 @@ MStatus initializePlugin(MObject MayaPluginObject)
 	// bus endpoint in LiveLinkProvider is up to date.
 	FTickerTick(1.0f);
 	MayaLiveLinkStreamManager::TheOne().Reset();
+	RunQueuedUnrealCommands();
 
 	MCallbackId MayaExitingCallbackId = MSceneMessage::addCallback(MSceneMessage::kMayaExiting, (MMessage::MBasicFunction)OnMayaExit);
 	myCallbackIds.append(MayaExitingCallbackId);
@@ -2764,6 +3733,13 @@ MStatus initializePlugin(MObject MayaPluginObject)
 	MCallbackId AnimKeyframeEditedCallbackId = MAnimMessage::addAnimKeyframeEditedCallback(OnAnimKeyframeEdited);
 	myCallbackIds.append(AnimKeyframeEditedCallbackId);
 
+	// The selected subjects are high priority, find them again only when the selection changes
+	myCallbackIds.append(MEventMessage::addEventCallback("SelectionChanged", OnSelectionChanged));
+
+	// Panels are created or torn off with the focus, follow them without rescanning the panels periodically
+	myCallbackIds.append(MEventMessage::addEventCallback("ModelPanelSetFocus", OnModelPanelEvent));
+	myCallbackIds.append(MEventMessage::addEventCallback("modelEditorChanged", OnModelPanelEvent));
+
 	// Update function every 5 seconds
 	MCallbackId timerCallback = MTimerMessage::addTimerCallback(5.f, (MMessage::MElapsedTimeFunction)OnInterval);
 	myCallbackIds.append(timerCallback);
@@ -2771,64 +3747,230 @@ MStatus initializePlugin(MObject MayaPluginObject)
 	MCallbackId	CallbackId = MDagMessage::addAllDagChangesCallback(AllDagChangesCallback);
 	myCallbackIds.append(CallbackId);
 
-	MayaPlugin.registerCommand(LiveLinkSubjectNamesCommandName, LiveLinkSubjectNamesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectPathsCommandName, LiveLinkSubjectPathsCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectRolesCommandName, LiveLinkSubjectRolesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectTypesCommandName, LiveLinkSubjectTypesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectLinkedAssetsCommandName, LiveLinkSubjectLinkedAssetsCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectTargetAssetsCommandName, LiveLinkSubjectTargetAssetsCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectLinkStatusCommandName, LiveLinkSubjectLinkStatusCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectClassesCommandName, LiveLinkSubjectClassesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSubjectUnrealNativeClassesCommandName, LiveLinkSubjectUnrealNativeClassesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkAddSelectionCommandName, LiveLinkAddSelectionCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkRemoveSubjectCommandName, LiveLinkRemoveSubjectCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkChangeSubjectNameCommandName, LiveLinkChangeSubjectNameCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkConnectionStatusCommandName, LiveLinkConnectionStatusCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkChangeSubjectStreamTypeCommandName, LiveLinkChangeSubjectStreamTypeCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkMessagingSettingsCommand::CommandName, LiveLinkMessagingSettingsCommand::Creator,
+	// Keep the scene deformer index up to date between subject rebuilds
+	for (const char* NodeType : { "skinCluster", "blendShape", "hikIKEffector" })
+	{
+		myCallbackIds.append(MDGMessage::addNodeAddedCallback(OnDeformerNodeAdded, NodeType));
+		myCallbackIds.append(MDGMessage::addNodeRemovedCallback(OnDeformerNodeRemoved, NodeType));
+	}
+
+	RefreshViewportCallbacks();
+
+	MGlobal::executeCommandOnIdle("MayaUnrealLiveLinkInitialized");
+
+	// Print to Maya's output window, too!
+	uint64 ResidentBytes = 0;
+	uint64 ResidentBytesBeforeInit = 0;
+	int32 NumThreads = 0;
+	UnrealInitializer::TheOne().GetFootprint(ResidentBytes, ResidentBytesBeforeInit, NumThreads);
+	MString InitializedMessage;
+	InitializedMessage.format("MayaUnrealLiveLinkPlugin initialized, Unreal initialized in ^1s s with ^2s threads, Maya resident memory ^3s MB (^4s MB before Unreal)",
+							  MString() + UnrealInitializer::TheOne().GetInitializationSeconds(),
+							  MString() + NumThreads,
+							  MString() + ResidentBytes / (1024.0 * 1024.0),
+							  MString() + ResidentBytesBeforeInit / (1024.0 * 1024.0));
+	MGlobal::displayInfo(InitializedMessage);
+
+	MayaUnrealLiveLinkUtils::RefreshUI();
+}
+
+void OnUnrealInitializationTimer(float ElapsedTime, float LastTime, void* ClientData)
+{
+	if (UnrealInitializer::TheOne().InitializeUnrealStep())
+	{
+		CompleteUnrealInitialization();
+	}
+}
+
+// The commands are registered right away but they can only run once Unreal is initialized,
+// a command used before then waits for the initialization to complete.
+template<void* (*Creator)()>
+void* CreatorWaitingForUnreal()
+{
+	CompleteUnrealInitialization();
+	return Creator();
+}
+
+// Commands adding or streaming subjects don't wait for Unreal, they are queued until it's initialized
+template<void* (*Creator)(), const MString* CommandName>
+void* CreatorQueuedUntilUnreal()
+{
+	if (!UnrealInitializationCompleted && UnrealInitializer::TheOne().IsUnrealInitialized())
+	{
+		CompleteUnrealInitialization();
+	}
+
+	if (UnrealInitializationCompleted)
+	{
+		return Creator();
+	}
+	return new QueuedUntilUnrealCommand(*CommandName);
+}
+
+/**
+* This function is called by Maya when the plugin becomes loaded
+*
+* @param	MayaPluginObject	The Maya object that represents our plugin
+*
+* @return	MS::kSuccess if everything went OK and the plugin is ready to use
+*/
+MStatus initializePlugin(MObject MayaPluginObject)
+{
+	PluginVersion = TCHAR_TO_ANSI(*FMayaLiveLinkInterfaceModule::GetPluginVersion());
+
+	// Tell Maya about our plugin
+	MFnPlugin MayaPlugin(
+		MayaPluginObject,
+		"Autodesk, Inc.",
+		PluginVersion.c_str());
+
+	// Check if another UE version of the plugin is already loaded
+	auto LoadedString = GetEnv(OtherUEVersionLoadedEnvVar);
+	if (LoadedString.empty())
+	{
+		// Create an environment variable telling that the current plugin is loaded
+		PutEnv(OtherUEVersionLoadedEnvVar, MayaPlugin.name().asChar());
+	}
+	else
+	{
+		// We're loading another UE version of the plugin, make sure it's different
+		// If it is, we're going to disable the auto-load for the previous plugin and
+		// activate the auto-load for the current plugin.
+		// We will also quit Maya to completely initialize Unreal.
+		auto PrevPluginName = MString(LoadedString.c_str());
+		if (MayaPlugin.name() != PrevPluginName)
+		{
+			MGlobal::displayWarning("Unable to load Unreal 5.x Live Link for Maya plug-in, because the Unreal 4.27 version of the same plug-in is/was already loaded.");
+
+			// Execute the command that will check for the auto-load status, change it for the current plugin and tell the user
+			// that Maya needs to be restarted for the change to take effect.
+			MGlobal::executeCommandOnIdle("MayaLiveLinkNotifyAndQuit \"" + MayaPlugin.name() + "\" \"" + PrevPluginName + "\"", false);
+
+			MayaUnrealLiveLinkUtils::RefreshUI();
+
+			// Must return success, otherwise we won't be able to set the autoload flag since Maya throws an exception if the plugin is not loaded
+			return MS::kSuccess;
+		}
+	}
+
+	if (UnrealInitializer::TheOne().HasInitializedOnce())
+	{
+		MGlobal::displayWarning("Unreal Live Link plug-in is unable to reload after unloading in same session. Please restart Maya to reload the plug-in again.");
+		const MStatus MayaStatusResult = MS::kFailure;
+		return MayaStatusResult;
+	}
+
+	const auto LoadStartTime = std::chrono::steady_clock::now();
+
+	// The profile must be known before initializing Unreal. The source is the one saved by the last session,
+	// unless it's overridden by the environment. The optionVars are already loaded when the plugin is loaded.
+	std::string SourceName = GetEnv(InitSourceEnvVar);
+	if (SourceName.empty())
+	{
+		bool bSourceSaved = false;
+		const MString SavedSourceName = MGlobal::optionVarStringValue("liveLinkSource", &bSourceSaved);
+		if (bSourceSaved)
+		{
+			SourceName = SavedSourceName.asChar();
+		}
+	}
+	LiveLinkSource InitialSource = LiveLinkSource::MessageBus;
+	for (int SourceIndex = 0; SourceIndex < LiveLinkSource::NumberOfSources; ++SourceIndex)
+	{
+		if (SourceName == LiveLinkSourceNames[SourceIndex])
+		{
+			InitialSource = static_cast<LiveLinkSource>(SourceIndex);
+		}
+	}
+	const std::string CoreLimit = GetEnv(CoreLimitEnvVar);
+	UnrealInitializer::TheOne().SetInitProfile(GetEnv(InitProfileEnvVar) == "Full" ? UnrealInitializer::EInitProfile::Full
+																				   : UnrealInitializer::EInitProfile::Minimal,
+											   InitialSource,
+											   CoreLimit.empty() ? 0 : std::atoi(CoreLimit.c_str()));
+
+	// The engine initialization takes a while, it's run in steps from the timer so that Maya isn't blocked
+	MStatus TimerStatus;
+	UnrealInitializationTimerCallbackId = MTimerMessage::addTimerCallback(0.1f, OnUnrealInitializationTimer, nullptr, &TimerStatus);
+	MREPORTERROR(TimerStatus, "MTimerMessage::addTimerCallback()");
+	UnrealInitializationTimerRegistered = TimerStatus == MStatus::kSuccess;
+
+	MayaPlugin.registerCommand(LiveLinkSubjectNamesCommandName, CreatorWaitingForUnreal<LiveLinkSubjectNamesCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectPathsCommandName, CreatorWaitingForUnreal<LiveLinkSubjectPathsCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectRolesCommandName, CreatorWaitingForUnreal<LiveLinkSubjectRolesCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectTypesCommandName, CreatorWaitingForUnreal<LiveLinkSubjectTypesCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectLinkedAssetsCommandName, CreatorWaitingForUnreal<LiveLinkSubjectLinkedAssetsCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectTargetAssetsCommandName, CreatorWaitingForUnreal<LiveLinkSubjectTargetAssetsCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectLinkStatusCommandName, CreatorWaitingForUnreal<LiveLinkSubjectLinkStatusCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectClassesCommandName, CreatorWaitingForUnreal<LiveLinkSubjectClassesCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSubjectUnrealNativeClassesCommandName, CreatorWaitingForUnreal<LiveLinkSubjectUnrealNativeClassesCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkAddSelectionCommandName, CreatorQueuedUntilUnreal<LiveLinkAddSelectionCommand::creator, &LiveLinkAddSelectionCommandName>);
+	MayaPlugin.registerCommand(LiveLinkRemoveSubjectCommandName, CreatorWaitingForUnreal<LiveLinkRemoveSubjectCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkChangeSubjectNameCommandName, CreatorWaitingForUnreal<LiveLinkChangeSubjectNameCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkConnectionStatusCommandName, CreatorWaitingForUnreal<LiveLinkConnectionStatusCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkChangeSubjectStreamTypeCommandName, CreatorQueuedUntilUnreal<LiveLinkChangeSubjectStreamTypeCommand::creator, &LiveLinkChangeSubjectStreamTypeCommandName>);
+	MayaPlugin.registerCommand(LiveLinkMessagingSettingsCommand::CommandName, CreatorWaitingForUnreal<LiveLinkMessagingSettingsCommand::Creator>,
 							   LiveLinkMessagingSettingsCommand::CreateSyntax);
-	MayaPlugin.registerCommand(LiveLinkChangeSourceCommandName, LiveLinkChangeSourceCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkSendSubjectListCommandName, LiveLinkSendSubjectListCommand::creator);
+	MayaPlugin.registerCommand(LiveLinkChangeSourceCommandName, CreatorWaitingForUnreal<LiveLinkChangeSourceCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkSendSubjectListCommandName, CreatorQueuedUntilUnreal<LiveLinkSendSubjectListCommand::creator, &LiveLinkSendSubjectListCommandName>);
 	MayaPlugin.registerCommand(LiveLinkGetSourceNamesCommandName, LiveLinkGetSourceNamesCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkGetSelectedSourceCommandName, LiveLinkGetSelectedSourceCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkExportStaticDataCommandName, LiveLinkExportStaticDataCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkExportFrameDataCommandName, LiveLinkExportFrameDataCommand::creator);
+	MayaPlugin.registerCommand(LiveLinkGetSelectedSourceCommandName, CreatorWaitingForUnreal<LiveLinkGetSelectedSourceCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkExportStaticDataCommandName, CreatorWaitingForUnreal<LiveLinkExportStaticDataCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkExportFrameDataCommandName, CreatorWaitingForUnreal<LiveLinkExportFrameDataCommand::creator>);
 	MayaPlugin.registerCommand(LiveLinkGetPluginVersionCommandName, LiveLinkGetPluginVersionCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkGetUnrealVersionCommandName, LiveLinkGetUnrealVersionCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkGetPluginAppIdCommandName, LiveLinkGetPluginAppIdCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkGetPluginRequestUrlCommandName, LiveLinkGetPluginRequestUrlCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkGetPluginUpdateUrlCommandName, LiveLinkGetPluginUpdateUrlCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkGetPluginDocumentationUrlCommandName, LiveLinkGetPluginDocumentationUrlCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkOnQuitCommandName, LiveLinkOnQuitCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkGetAssetsByClassCommandName, LiveLinkGetAssetsByClassCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkGetAssetsByParentClassCommandName, LiveLinkGetAssetsByParentClassCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkGetActorsByClassCommandName, LiveLinkGetActorsByClassCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkGetAnimSequencesBySkeletonCommandName, LiveLinkGetAnimSequencesBySkeletonCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkLinkUnrealAssetCommandName, LiveLinkLinkUnrealAssetCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkUnlinkUnrealAssetCommandName, LiveLinkUnlinkUnrealAssetCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkBakeUnrealAssetCommandName, LiveLinkBakeUnrealAssetCommand::creator);
-	MayaPlugin.registerCommand(LiveLinkUnbakeUnrealAssetCommandName, LiveLinkUnbakeUnrealAssetCommand::creator);
+	MayaPlugin.registerCommand(LiveLinkOnQuitCommandName, CreatorWaitingForUnreal<LiveLinkOnQuitCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkGetAssetsByClassCommandName, CreatorWaitingForUnreal<LiveLinkGetAssetsByClassCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkGetAssetsByParentClassCommandName, CreatorWaitingForUnreal<LiveLinkGetAssetsByParentClassCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkGetActorsByClassCommandName, CreatorWaitingForUnreal<LiveLinkGetActorsByClassCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkGetAnimSequencesBySkeletonCommandName, CreatorWaitingForUnreal<LiveLinkGetAnimSequencesBySkeletonCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkLinkUnrealAssetCommandName, CreatorWaitingForUnreal<LiveLinkLinkUnrealAssetCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkUnlinkUnrealAssetCommandName, CreatorWaitingForUnreal<LiveLinkUnlinkUnrealAssetCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkBakeUnrealAssetCommandName, CreatorWaitingForUnreal<LiveLinkBakeUnrealAssetCommand::creator>);
+	MayaPlugin.registerCommand(LiveLinkUnbakeUnrealAssetCommandName, CreatorWaitingForUnreal<LiveLinkUnbakeUnrealAssetCommand::creator>);
 	MayaPlugin.registerCommand(LiveLinkPluginUninitializedCommandName, LiveLinkPluginUninitializedCommand::creator);
 	MayaPlugin.registerCommand(LiveLinkPlayheadSyncCommandName,
-							   LiveLinkPlayheadSyncCommand::creator,
+							   CreatorWaitingForUnreal<LiveLinkPlayheadSyncCommand::creator>,
 							   LiveLinkPlayheadSyncCommand::CreateSyntax);
 	MayaPlugin.registerCommand(LiveLinkObjectTransformSyncCommandName,
 							   LiveLinkObjectTransformSyncCommand::creator,
 							   LiveLinkObjectTransformSyncCommand::CreateSyntax);
-	MayaPlugin.registerCommand(LiveLinkPauseAnimSyncCommandName, LiveLinkPauseAnimSyncCommand::creator,
+	MayaPlugin.registerCommand(LiveLinkPauseAnimSyncCommandName, CreatorWaitingForUnreal<LiveLinkPauseAnimSyncCommand::creator>,
 							   LiveLinkPauseAnimSyncCommand::CreateSyntax);
-
-	MGlobal::executeCommandOnIdle("MayaUnrealLiveLinkInitialized");
-
-	// Print to Maya's output window, too!
-	MGlobal::displayInfo("MayaUnrealLiveLinkPlugin initialized");
+	MayaPlugin.registerCommand(LiveLinkSubjectStreamMaskCommand::CommandName, CreatorWaitingForUnreal<LiveLinkSubjectStreamMaskCommand::Creator>,
+							   LiveLinkSubjectStreamMaskCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkStreamScheduleCommand::CommandName, LiveLinkStreamScheduleCommand::Creator,
+							   LiveLinkStreamScheduleCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkRebakeDelayCommand::CommandName, LiveLinkRebakeDelayCommand::Creator,
+							   LiveLinkRebakeDelayCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkFrameHeartbeatCommand::CommandName, CreatorWaitingForUnreal<LiveLinkFrameHeartbeatCommand::Creator>,
+							   LiveLinkFrameHeartbeatCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkPlaybackLookAheadCommand::CommandName, LiveLinkPlaybackLookAheadCommand::Creator,
+							   LiveLinkPlaybackLookAheadCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkStreamTickCommand::CommandName, CreatorWaitingForUnreal<LiveLinkStreamTickCommand::Creator>,
+							   LiveLinkStreamTickCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkDestinationsCommand::CommandName, CreatorWaitingForUnreal<LiveLinkDestinationsCommand::Creator>,
+							   LiveLinkDestinationsCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkProfilingStatsCommand::CommandName, CreatorWaitingForUnreal<LiveLinkProfilingStatsCommand::Creator>,
+							   LiveLinkProfilingStatsCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkCallbackStatsCommand::CommandName, CreatorWaitingForUnreal<LiveLinkCallbackStatsCommand::Creator>);
+	MayaPlugin.registerCommand(LiveLinkDagChangeStatsCommand::CommandName, LiveLinkDagChangeStatsCommand::Creator);
+	MayaPlugin.registerCommand(LiveLinkAnimSequenceLayoutCommand::CommandName, CreatorWaitingForUnreal<LiveLinkAnimSequenceLayoutCommand::Creator>,
+							   LiveLinkAnimSequenceLayoutCommand::CreateSyntax);
+	MayaPlugin.registerCommand(LiveLinkUnrealFootprintCommand::CommandName, CreatorWaitingForUnreal<LiveLinkUnrealFootprintCommand::Creator>);
 
 	MGlobal::executeCommandOnIdle("SetCommandCategory");
 
-	RefreshViewportCallbacks();
-
 	MayaUnrealLiveLinkUtils::RefreshUI();
 
+	MString LoadedMessage;
+	LoadedMessage.format("MayaUnrealLiveLinkPlugin loaded in ^1s ms, initializing Unreal",
+						 MString() + std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - LoadStartTime).count());
+	MGlobal::displayInfo(LoadedMessage);
+
 	const MStatus MayaStatusResult = MS::kSuccess;
 	return MayaStatusResult;
 }
@@ -2837,13 +3979,42 @@ MStatus initializePlugin(MObject MayaPluginObject)
 /**
 * Called by Maya either at shutdown, or when the user opts to unload the plugin through the Plugin Manager
 *
+* The work queued for later is dropped instead of being run: the commands waiting for Unreal,
+* the DAG changes not processed yet and the modules not loaded yet. The engine is only pre-initialized
+* if it started initializing, so that it can exit. The engine exit has no deadline since it can't be
+* interrupted safely. Each step is timed and reported to find out which one is slow.
+*
 * @param	MayaPluginObject	The Maya object that represents our plugin
 *
 * @return	MS::kSuccess if everything went OK and the plugin was fully shut down
 */
 MStatus uninitializePlugin(MObject MayaPluginObject)
 {
-	DetectIdleEvent.Reset();
+	const auto ShutdownStartTime = std::chrono::steady_clock::now();
+	auto ElapsedMs = [](const std::chrono::steady_clock::time_point& Start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+	};
+
+	// Turn the queued idle tasks and the callbacks from the messaging threads into no-ops
+	PluginShuttingDown = true;
+
+	RemovePlaybackRangeTimer();
+	RemoveUnrealInitializationTimer();
+
+	// Drop the queued work, it would run once the plugin is unloaded
+	const size_t NumDroppedItems = QueuedUnrealCommands.size() + PendingParentsAdded.size();
+	QueuedUnrealCommands.clear();
+	PendingParentsAdded.clear();
+
+	// The engine must be pre-initialized before it can be shut down, unless it wasn't started yet.
+	// The remaining steps run on this thread, there's no other thread to wait for.
+	const bool bUnrealStarted = UnrealInitializer::TheOne().HasStartedInitialization();
+	if (bUnrealStarted)
+	{
+		UnrealInitializer::TheOne().InitializeUnrealForShutdown();
+	}
+	const double WaitForUnrealMs = ElapsedMs(ShutdownStartTime);
 
 	// Get the plugin API for the plugin object
 	MFnPlugin MayaPlugin(MayaPluginObject);
@@ -2900,6 +4071,18 @@ MStatus uninitializePlugin(MObject MayaPluginObject)
 	MayaPlugin.deregisterCommand(LiveLinkPluginUninitializedCommandName);
 	MayaPlugin.deregisterCommand(LiveLinkPlayheadSyncCommandName);
 	MayaPlugin.deregisterCommand(LiveLinkPauseAnimSyncCommandName);
+	MayaPlugin.deregisterCommand(LiveLinkSubjectStreamMaskCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkStreamScheduleCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkRebakeDelayCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkFrameHeartbeatCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkPlaybackLookAheadCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkStreamTickCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkDestinationsCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkProfilingStatsCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkCallbackStatsCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkDagChangeStatsCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkAnimSequenceLayoutCommand::CommandName);
+	MayaPlugin.deregisterCommand(LiveLinkUnrealFootprintCommand::CommandName);
 
 	ClearViewportCallbacks();
 	if (myCallbackIds.length() != 0)
@@ -2908,18 +4091,38 @@ MStatus uninitializePlugin(MObject MayaPluginObject)
 		MMessage::removeCallbacks(myCallbackIds);
 	}
 
+	const auto StopLiveLinkStartTime = std::chrono::steady_clock::now();
 	MayaLiveLinkStreamManager::TheOne().ClearSubjects();
+	FUnrealStreamManager::TheOne().RemoveAllLiveLinkDestinations();
 	UnrealInitializer::TheOne().StopLiveLink();
 
+	// Release the message endpoints and sockets while the engine modules they use are still loaded
+	FUnrealStreamManager::TheOne().ReleaseLiveLinkProviders();
+	const double StopLiveLinkMs = ElapsedMs(StopLiveLinkStartTime);
+
 	// Make sure the Garbage Collector does not try to remove Delete Listeners on shutdown as those will be invalid causing a crash
-	RequestEngineExit(TEXT("MayaUnrealLiveLink uninitializePlugin"));
+	const auto EngineExitStartTime = std::chrono::steady_clock::now();
+	if (bUnrealStarted)
+	{
+		RequestEngineExit(TEXT("MayaUnrealLiveLink uninitializePlugin"));
 
-	UnrealInitializer::TheOne().UninitializeUnreal();
+		UnrealInitializer::TheOne().UninitializeUnreal();
 
-	FTickerTick(1.f);
+		FTickerTick(1.f);
+	}
+	const double EngineExitMs = ElapsedMs(EngineExitStartTime);
 
 	MayaUnrealLiveLinkUtils::RefreshUI();
 
+	MString ShutdownMessage;
+	ShutdownMessage.format("MayaUnrealLiveLinkPlugin shut down in ^1s ms (waiting for Unreal ^2s ms, Live Link ^3s ms, engine exit ^4s ms, ^5s queued items dropped)",
+						   MString() + ElapsedMs(ShutdownStartTime),
+						   MString() + WaitForUnrealMs,
+						   MString() + StopLiveLinkMs,
+						   MString() + EngineExitMs,
+						   MString() + static_cast<unsigned int>(NumDroppedItems));
+	MGlobal::displayInfo(ShutdownMessage);
+
 	const MStatus MayaStatusResult = MS::kSuccess;
 	return MayaStatusResult;
 }
@@ -23,8 +23,9 @@
 #include "MayaUnrealLiveLinkUtils.h"
 
 THIRD_PARTY_INCLUDES_START
+#include <maya/MAnimControl.h>
+#include <maya/MDGContext.h>
 #include <maya/MEulerRotation.h>
-#include <maya/MFnIkJoint.h>
 #include <maya/MFnTransform.h>
 #include <maya/MMatrix.h>
 #include <maya/MQuaternion.h>
@@ -49,50 +50,6 @@ double MayaUnrealLiveLinkUtils::DegToRad(double Deg)
 	return Deg * (E_PI / 180.0f);
 }
 
-MMatrix MayaUnrealLiveLinkUtils::GetScale(const MFnTransform& Joint)
-{
-	double Scale[3];
-	Joint.getScale(Scale);
-	MTransformationMatrix M;
-	M.setScale(Scale, G_TransformSpace);
-	return M.asMatrix();
-}
-
-MMatrix MayaUnrealLiveLinkUtils::GetRotationOrientation(const MFnIkJoint& Joint, MTransformationMatrix::RotationOrder& RotOrder)
-{
-	double ScaleOrientation[3];
-	Joint.getScaleOrientation(ScaleOrientation, RotOrder);
-	MTransformationMatrix M;
-	M.setRotation(ScaleOrientation, RotOrder);
-	return M.asMatrix();
-}
-
-MMatrix MayaUnrealLiveLinkUtils::GetRotation(const MFnTransform& Joint, MTransformationMatrix::RotationOrder& RotOrder)
-{
-	double Rotation[3];
-	Joint.getRotation(Rotation, RotOrder);
-	MTransformationMatrix M;
-	M.setRotation(Rotation, RotOrder);
-	return M.asMatrix();
-}
-
-MMatrix MayaUnrealLiveLinkUtils::GetJointOrientation(const MFnIkJoint& Joint, MTransformationMatrix::RotationOrder& RotOrder)
-{
-	double JointOrientation[3];
-	Joint.getOrientation(JointOrientation, RotOrder);
-	MTransformationMatrix M;
-	M.setRotation(JointOrientation, RotOrder);
-	return M.asMatrix();
-}
-
-MMatrix MayaUnrealLiveLinkUtils::GetTranslation(const MFnTransform& Joint)
-{
-	MVector Translation = Joint.getTranslation(G_TransformSpace);
-	MTransformationMatrix M;
-	M.setTranslation(Translation, G_TransformSpace);
-	return M.asMatrix();
-}
-
 void MayaUnrealLiveLinkUtils::ComputeTransformHierarchy(MObject& Node, MMatrix& MayaTransform)
 {
 	MFnTransform TransformNode(Node);
@@ -205,7 +162,9 @@ FFrameRate MayaUnrealLiveLinkUtils::GetMayaFrameRateAsUnrealFrameRate()
 
 FQualifiedFrameTime MayaUnrealLiveLinkUtils::GetMayaFrameTimeAsUnrealTime()
 {
-	MTime Time = MAnimControl::currentTime();
+	// Frames evaluated in a timed context, like the playback look-ahead, use the time of the context
+	const MDGContext& Context = MDGContext::current();
+	MTime Time = Context.isNormal() ? MAnimControl::currentTime() : Context.getTime();
 	return FQualifiedFrameTime(static_cast<int32>(Time.as(Time.unit())), GetMayaFrameRateAsUnrealFrameRate());
 }
 
@@ -31,11 +31,6 @@ namespace MayaUnrealLiveLinkUtils
 	double RadToDeg(double Rad);
 	double DegToRad(double Deg);
 
-	MMatrix GetScale(const MFnTransform& Joint);
-	MMatrix GetRotationOrientation(const MFnIkJoint& Joint, MTransformationMatrix::RotationOrder& RotOrder);
-	MMatrix GetRotation(const MFnTransform& Joint, MTransformationMatrix::RotationOrder& RotOrder);
-	MMatrix GetJointOrientation(const MFnIkJoint& Joint, MTransformationMatrix::RotationOrder& RotOrder);
-	MMatrix GetTranslation(const MFnTransform& Joint);
 	MStatus GetSelectedSubjectDagPath(MDagPath& DagPath);
 
 	void ComputeTransformHierarchy(MObject& Node, MMatrix& MayaTransform);
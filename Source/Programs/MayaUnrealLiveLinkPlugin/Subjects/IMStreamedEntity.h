@@ -57,6 +57,21 @@ public:
 		MString UnrealNativeClass; // Base C++ class when UnrealAssetClass is a blueprint
 	};
 
+	// Scheduling information used by the stream manager to decide when the subject is streamed
+	struct StreamScheduleInfo
+	{
+		double TargetRate = 0.0;		// Streams per second, 0 to stream on every tick
+		bool bHighPriority = false;		// High priority subjects are always served
+		bool bSelected = false;			// Selected subjects are high priority too
+		double LastStreamTime = 0.0;
+
+		// The playback look-ahead streams future world times, it keeps its own stamps so that
+		// the live stream isn't held back once the playback stops
+		bool bLookAheadStreamed = false;
+		double LastLookAheadTime = 0.0;
+		double LastLookAheadFrame = 0.0;
+	};
+
 	explicit IMStreamedEntity(const MDagPath& DagPath) : MStreamedEntity(DagPath) {}
 	virtual ~IMStreamedEntity() {}
 
@@ -79,5 +94,35 @@ public:
 	virtual void LinkUnrealAsset(const LinkAssetInfo& LinkInfo) {}
 	virtual void UnlinkUnrealAsset() {}
 	virtual void SetBakeUnrealAsset(bool shouldBakeCurves) {}
+	// Streaming mask: joint sub-trees and curves (or curve groups) left out of the stream
+	virtual bool SupportsStreamMask() const { return false; }
+	virtual void SetStreamMask(const MStringArray& ExcludedJoints, const MStringArray& ExcludedCurves) {}
+	virtual void GetStreamMask(MStringArray& ExcludedJoints, MStringArray& ExcludedCurves) const {}
 	virtual void OnTimeUnitChanged() {}
+
+	StreamScheduleInfo& GetStreamSchedule() { return StreamSchedule; }
+	const StreamScheduleInfo& GetStreamSchedule() const { return StreamSchedule; }
+
+	// Is the subject due to be streamed according to its target rate
+	bool IsStreamDue(double StreamTime) const
+	{
+		return StreamSchedule.TargetRate <= 0.0 ||
+			   StreamTime - StreamSchedule.LastStreamTime >= 1.0 / StreamSchedule.TargetRate;
+	}
+
+	// Was the look-ahead frame already streamed by a previous tick
+	bool IsLookAheadFrameStreamed(double FrameNumber) const
+	{
+		return StreamSchedule.bLookAheadStreamed && FrameNumber <= StreamSchedule.LastLookAheadFrame;
+	}
+
+	// Is the subject due to be streamed in the look-ahead according to its target rate
+	bool IsLookAheadDue(double StreamTime) const
+	{
+		return !StreamSchedule.bLookAheadStreamed || StreamSchedule.TargetRate <= 0.0 ||
+			   StreamTime - StreamSchedule.LastLookAheadTime >= 1.0 / StreamSchedule.TargetRate;
+	}
+
+private:
+	StreamScheduleInfo StreamSchedule;
 };
@@ -40,6 +40,7 @@ MStringArray MLiveLinkBaseCameraSubject::CameraStreamOptions (CameraStreams, 3);
 MLiveLinkBaseCameraSubject::MLiveLinkBaseCameraSubject(const MString& InSubjectName, MCameraStreamMode InStreamMode, const MDagPath& InRootPath)
 	: IMStreamedEntity(InRootPath)
 	, SubjectName(InSubjectName)
+	, LiveLinkSubjectName(InSubjectName.asChar())
 	, StreamMode(InStreamMode >= 0 && InStreamMode < CameraStreamOptions.length() ? InStreamMode : MCameraStreamMode::Camera)
 {}
 
@@ -75,12 +76,12 @@ bool MLiveLinkBaseCameraSubject::RebuildSubjectData(bool ForceRelink)
 	if (StreamMode == MCameraStreamMode::RootOnly)
 	{
 		MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkTransformStaticData>();
-		return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(SubjectName, "RootOnly");
+		return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(LiveLinkSubjectName, EStreamRole::Transform);
 	}
 	else if (StreamMode == MCameraStreamMode::FullHierarchy)
 	{
 		MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkSkeletonStaticData>();
-		return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(SubjectName, "FullHierarchy");
+		return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(LiveLinkSubjectName, EStreamRole::Animation);
 	}
 	else if (StreamMode == MCameraStreamMode::Camera)
 	{
@@ -88,7 +89,7 @@ bool MLiveLinkBaseCameraSubject::RebuildSubjectData(bool ForceRelink)
 		{
 			FLiveLinkCameraStaticData& StaticData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkCameraStaticData>();
 			InitializeStaticData(StaticData);
-			return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(SubjectName, "Camera");
+			return MayaLiveLinkStreamManager::TheOne().RebuildBaseCameraSubjectData(LiveLinkSubjectName, EStreamRole::Camera);
 		}
 		else
 		{
@@ -128,7 +129,7 @@ void MLiveLinkBaseCameraSubject::StreamCamera(const MDagPath& CameraPath, double
 			CameraTransformData.WorldTime = StreamTime;
 			CameraTransformData.MetaData.SceneTime = SceneTime;
 
-			MayaLiveLinkStreamManager::TheOne().StreamCamera(SubjectName, "RootOnly");
+			MayaLiveLinkStreamManager::TheOne().StreamCamera(LiveLinkSubjectName, EStreamRole::Transform);
 		}
 		else if (StreamMode == MCameraStreamMode::FullHierarchy)
 		{
@@ -137,7 +138,7 @@ void MLiveLinkBaseCameraSubject::StreamCamera(const MDagPath& CameraPath, double
 			AnimationData.WorldTime = StreamTime;
 			AnimationData.MetaData.SceneTime = SceneTime;
 
-			MayaLiveLinkStreamManager::TheOne().StreamCamera(SubjectName, "FullHierarchy");
+			MayaLiveLinkStreamManager::TheOne().StreamCamera(LiveLinkSubjectName, EStreamRole::Animation);
 		}
 		else if (StreamMode == MCameraStreamMode::Camera)
 		{
@@ -154,7 +155,7 @@ void MLiveLinkBaseCameraSubject::StreamCamera(const MDagPath& CameraPath, double
 				CameraData.FocusDistance = C.focusDistance();
 				CameraData.ProjectionMode = C.isOrtho() ? ELiveLinkCameraProjectionMode::Orthographic : ELiveLinkCameraProjectionMode::Perspective;
 
-				MayaLiveLinkStreamManager::TheOne().StreamCamera(SubjectName, "Camera");
+				MayaLiveLinkStreamManager::TheOne().StreamCamera(LiveLinkSubjectName, EStreamRole::Camera);
 			}
 			else
 			{
@@ -163,7 +164,7 @@ void MLiveLinkBaseCameraSubject::StreamCamera(const MDagPath& CameraPath, double
 					auto& FrameData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkLevelSequenceFrameData>();
 					InitializeFrameData(FrameData);
 					AnimCurves.clear();
-					MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(SubjectName);
+					MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(LiveLinkSubjectName);
 				}
 			}
 		}
@@ -72,6 +72,7 @@ protected:
 
 protected:
 	MString  SubjectName;
+	FName LiveLinkSubjectName;
 
 	static MStringArray CameraStreamOptions;
 	MCameraStreamMode StreamMode;
@@ -68,7 +68,7 @@ bool MLiveLinkCameraSubject::RebuildSubjectData(bool ForceRelink)
 			{
 				FLiveLinkCameraStaticData& StaticData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkCameraStaticData>();
 				InitializeStaticData(StaticData);
-				MayaLiveLinkStreamManager::TheOne().RebuildCameraSubjectData(SubjectName, "Camera");
+				MayaLiveLinkStreamManager::TheOne().RebuildCameraSubjectData(LiveLinkSubjectName, EStreamRole::Camera);
 			}
 			else
 			{
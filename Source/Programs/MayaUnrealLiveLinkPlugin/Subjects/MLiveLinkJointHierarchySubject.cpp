@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #include "MLiveLinkJointHierarchySubject.h"
+#include "MSceneDeformerIndex.h"
 #include <algorithm>
 
 #include "../MayaLiveLinkStreamManager.h"
@@ -32,16 +33,19 @@
 THIRD_PARTY_INCLUDES_START
 #include <maya/MAnimUtil.h>
 #include <maya/MDGContextGuard.h>
-#include <maya/MFnSkinCluster.h>
-#include <maya/MItDependencyNodes.h>
+#include <maya/MFnIkJoint.h>
 THIRD_PARTY_INCLUDES_END
 
 MString CharacterStreams[2] = { "Transform", "Animation" };
 MStringArray MLiveLinkJointHierarchySubject::CharacterStreamOptions(CharacterStreams, 2);
 
+// Number of frames sent per message when streaming a whole anim sequence
+static const int AnimSequenceChunkSize = 128;
+
 MLiveLinkJointHierarchySubject::MLiveLinkJointHierarchySubject(const MString& InSubjectName, const MDagPath& InRootPath, MCharacterStreamMode InStreamMode)
 : IMStreamedEntity(InRootPath)
 , SubjectName(InSubjectName)
+, LiveLinkSubjectName(InSubjectName.asChar())
 , StreamMode(InStreamMode >= 0 && InStreamMode < CharacterStreamOptions.length() ? InStreamMode : MCharacterStreamMode::FullHierarchy)
 , bLinked(false)
 , StreamFullAnimSequence(false)
@@ -133,7 +137,7 @@ bool MLiveLinkJointHierarchySubject::RebuildSubjectData(bool ForceRelink)
 	if (StreamMode == MCharacterStreamMode::RootOnly)
 	{
 		MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkTransformStaticData>();
-		return MayaLiveLinkStreamManager::TheOne().RebuildJointHierarchySubject(SubjectName, "RootOnly");
+		return MayaLiveLinkStreamManager::TheOne().RebuildJointHierarchySubject(LiveLinkSubjectName, EStreamRole::Transform);
 	}
 	else if (StreamMode == MCharacterStreamMode::FullHierarchy)
 	{
@@ -199,7 +203,7 @@ bool MLiveLinkJointHierarchySubject::RebuildSubjectData(bool ForceRelink)
 					MFnAttribute Attr(Node.attribute(i));
 					auto Plug = Node.findPlug(Attr.name(), true);
 
-					if (Plug.isDynamic() && Plug.isKeyable())
+					if (Plug.isDynamic() && Plug.isKeyable() && !IsCurveExcluded(Attr.name()))
 					{
 						DynamicPlugs.append(Plug);
 
@@ -250,10 +254,13 @@ bool MLiveLinkJointHierarchySubject::RebuildSubjectData(bool ForceRelink)
 							for (unsigned int IdxWeight = 0; IdxWeight < Plug.numElements(); IdxWeight++)
 							{
 								const auto& PlugElement = Plug[IdxWeight];
-								UpdateKeyFrames(PlugElement, Plug);
+								if (!IsCurveExcluded(MayaUnrealLiveLinkUtils::GetPlugAliasName(PlugElement), BlendShape.name()))
+								{
+									UpdateKeyFrames(PlugElement, Plug);
+								}
 							}
 						}
-						else
+						else if (!IsCurveExcluded(MayaUnrealLiveLinkUtils::GetPlugAliasName(Plug), BlendShape.name()))
 						{
 							UpdateKeyFrames(Plug, Plug);
 						}
@@ -276,11 +283,11 @@ bool MLiveLinkJointHierarchySubject::RebuildSubjectData(bool ForceRelink)
 			{
 				if(!ShouldBakeCurves)
 					BaseStaticData->PropertyNames.Empty();
-				MayaLiveLinkStreamManager::TheOne().RebuildAnimSequenceSubject(SubjectName);
+				MayaLiveLinkStreamManager::TheOne().RebuildAnimSequenceSubject(LiveLinkSubjectName);
 			}
 			else
 			{
-				Status = MayaLiveLinkStreamManager::TheOne().RebuildJointHierarchySubject(SubjectName, "FullHierarchy");
+				Status = MayaLiveLinkStreamManager::TheOne().RebuildJointHierarchySubject(LiveLinkSubjectName, EStreamRole::Animation);
 			}
 		}
 		return Status;
@@ -317,6 +324,14 @@ bool MLiveLinkJointHierarchySubject::BuildStaticData(T& AnimationData,
 		{
 			MDagPath JointPath;
 			Status = JointIterator.getPath(JointPath);
+
+			// Skip the whole sub-tree of joints excluded by the streaming mask so that they are never evaluated
+			if (IsJointExcluded(JointPath))
+			{
+				JointIterator.prune();
+				continue;
+			}
+
 			MString JointName;
 			bool Valid = false;
 			if (JointPath.hasFn(MFn::kJoint))
@@ -359,108 +374,60 @@ bool MLiveLinkJointHierarchySubject::BuildStaticData(T& AnimationData,
 	return ValidSubject;
 }
 
-// Iterate through skin clusters in the scene and find skin cluster attach to the skeleton we try to stream
+// Find the skin clusters attached to the skeleton we try to stream from the scene deformer index
 // Will return the MObject skinned to the skeleton through second argument "meshes"
 void MLiveLinkJointHierarchySubject::GetGeometrySkinnedToSkeleton(const std::vector<MObject>& Skeleton, std::vector<MObject>& Meshes)
 {
-	// Iterate through skin clusters
-	MItDependencyNodes SkinClusterIterator(MFn::kSkinClusterFilter);
-
-	for (; !SkinClusterIterator.isDone(); SkinClusterIterator.next())
-	{
-		MObject SkinClusterObject = SkinClusterIterator.thisNode();
-		MFnSkinCluster SkinCluster(SkinClusterObject);
-
-		// Get the objects that influence the skin cluster. Should contain the bones bind to this skin cluster.
-		MDagPathArray InfluenceObjectPaths;
-		unsigned int NumInfluenceObjects = SkinCluster.influenceObjects(InfluenceObjectPaths);
-
-		// For each influence objects, check if one of them is an object in the skeleton. If so, that means the skin cluster
-		//    is attached to the character we are trying to stream.
-		for (unsigned int IdxInfluenceObject = 0; IdxInfluenceObject < NumInfluenceObjects; IdxInfluenceObject++)
-		{
-			MDagPath& InfluenceObjectPath = InfluenceObjectPaths[IdxInfluenceObject];
-
-			if (std::find(Skeleton.begin(), Skeleton.end(), InfluenceObjectPath.node()) != Skeleton.end())
-			{
-				// Loop through the geometries affected by this skin cluster
-				unsigned int NumGeoms = SkinCluster.numOutputConnections();
-
-				for (unsigned int IdxGeoms = 0; IdxGeoms < NumGeoms; IdxGeoms++)
-				{
-					unsigned int IndexGeometry = SkinCluster.indexForOutputConnection(IdxGeoms);
-
-					// Get the dag path of the IdxGeoms'th geometry
-					MDagPath GeometryPath;
-					SkinCluster.getPathAtIndex(IndexGeometry, GeometryPath);
-
-
-					// Add the geometry object to the meshes to return if its not already in the list
-					if (std::find(Meshes.begin(), Meshes.end(), GeometryPath.node()) == Meshes.end())
-					{
-						Meshes.emplace_back(GeometryPath.node());
-					}
-				}
-				// If the skeleton identified as one of the influence object of the current skin cluster, All the geometry
-				//    have been added to the meshes list, we can now jump to the next skin cluster without having to go through
-				//    all the influence objects.
-				break;
-			}
-		}
-	}
+	MSceneDeformerIndex::TheOne().GetSkinnedGeometries(Skeleton, Meshes);
 }
 
-// Iterate through the blend shapes in the scene to find the blend shapes associate with the Meshes given in argument.
-// If the blend shapes is related to the Meshes given in argument, it will add the name of each weight to the CurveNames.
+// Find the blend shapes associated with the Meshes given in argument from the scene deformer index.
+// It will add the name of each weight of these blend shapes to the CurveNames.
 // Stock the blend shapes related to the character in the variable "BlendShapeObjects".
 void MLiveLinkJointHierarchySubject::AddBlendShapesWeightNameToStream(const std::vector<MObject>& Meshes)
 {
-	// Iterate through blendshapes
-	MItDependencyNodes BlendShapeIterator(MFn::kBlendShape);
+	std::vector<MObject> BlendShapes;
+	MSceneDeformerIndex::TheOne().GetBlendShapesDeforming(Meshes, BlendShapes);
 	const auto CurveNamesLen = CurveNames.length();
 
-	while (!BlendShapeIterator.isDone())
+	for (const auto& BlendShapeObject : BlendShapes)
 	{
-		MFnBlendShapeDeformer BlendShape(BlendShapeIterator.thisNode());
+		MFnBlendShapeDeformer BlendShape(BlendShapeObject);
+		if (IsCurveExcluded(MString(), BlendShape.name()))
+		{
+			continue;
+		}
 
-		// Get the base objects of the current blendshape. The base objects are the shapes that are to be deformed
-		MObjectArray BaseObjects;
-		BlendShape.getBaseObjects(BaseObjects);
+		// Get the plug of the weight attribute. Get their alias name and add them to the curvesName to be stream. 
+		// Does not allow 2 curves with the same name.
+		MPlug Plug = BlendShape.findPlug("weight", false);
 
-		// Iterate through the base object to see if the base objects are contains in the list of meshes associate with the character.
-		for (unsigned int IdxBaseObject = 0; IdxBaseObject < BaseObjects.length(); IdxBaseObject++)
+		if (!Plug.isNull() && Plug.isArray())
 		{
-			if (std::find(Meshes.begin(), Meshes.end(), BaseObjects[IdxBaseObject]) != Meshes.end())
+			for (unsigned int IdxWeight = 0; IdxWeight < Plug.numElements(); IdxWeight++)
 			{
-				// Get the plug of the weight attribute. Get their alias name and add them to the curvesName to be stream. 
-				// Does not allow 2 curves with the same name.
-				MPlug Plug = BlendShape.findPlug("weight", false);
+				MString WeightName = MayaUnrealLiveLinkUtils::GetPlugAliasName(Plug[IdxWeight]);
+				if (IsCurveExcluded(WeightName))
+				{
+					continue;
+				}
 
-				if (!Plug.isNull() && Plug.isArray())
+				bool CurveFound = false;
+				for (unsigned int i = 0; i < CurveNamesLen; ++i)
 				{
-					for (unsigned int IdxWeight = 0; IdxWeight < Plug.numElements(); IdxWeight++)
+					if (WeightName == CurveNames[i])
 					{
-						MString WeightName = MayaUnrealLiveLinkUtils::GetPlugAliasName(Plug[IdxWeight]);
-
-						bool CurveFound = false;
-						for (unsigned int i = 0; i < CurveNamesLen; ++i)
-						{
-							if (WeightName == CurveNames[i])
-							{
-								CurveFound = true;
-								break;
-							}
-						}
-						if (!CurveFound)
-						{
-							CurveNames.append(WeightName);
-						}
+						CurveFound = true;
+						break;
 					}
 				}
-				BlendShapeObjects.emplace_back(BlendShapeIterator.thisNode());
+				if (!CurveFound)
+				{
+					CurveNames.append(WeightName);
+				}
 			}
 		}
-		BlendShapeIterator.next();
+		BlendShapeObjects.emplace_back(BlendShapeObject);
 	}
 }
 
@@ -485,7 +452,7 @@ void MLiveLinkJointHierarchySubject::OnStream(double StreamTime, double CurrentT
 		// Convert Maya Camera orientation to Unreal
 		TransformData.Transform = MayaUnrealLiveLinkUtils::BuildUETransformFromMayaTransform(Transform);
 
-		MayaLiveLinkStreamManager::TheOne().OnStreamJointHierarchySubject(SubjectName, "RootOnly");
+		MayaLiveLinkStreamManager::TheOne().OnStreamJointHierarchySubject(LiveLinkSubjectName, EStreamRole::Transform);
 	}
 	else if (StreamMode == MCharacterStreamMode::FullHierarchy)
 	{
@@ -529,46 +496,140 @@ void MLiveLinkJointHierarchySubject::OnStream(double StreamTime, double CurrentT
 				Frame.PropertyValues.Add(val);
 			};
 
-			auto InitializeAndStreamFrameData = [this](FMayaLiveLinkAnimSequenceFrameData& AnimationData, double StreamTime)
+			auto InitializeAndStreamFrameData = [this](auto& AnimationData, double StreamTime)
 			{
 				InitializeFrameData(AnimationData, MAnimControl::minTime().as(MTime::uiUnit()));
 				AnimationData.PropertyValues.Empty();
 				AnimationData.WorldTime = StreamTime;
 				AnimCurves.clear();
-				MayaLiveLinkStreamManager::TheOne().OnStreamAnimSequenceSubject(SubjectName);
+				MayaLiveLinkStreamManager::TheOne().OnStreamAnimSequenceSubject(LiveLinkSubjectName);
+			};
+
+			// Long bakes are sent in chunks as they are evaluated, the curves are sent with the final chunk
+			auto StreamChunk = [this, &InitializeAndStreamFrameData](auto& AnimationData, bool bFinalChunk, double StreamTime)
+			{
+				AnimationData.bFinalChunk = bFinalChunk;
+				if (bFinalChunk)
+				{
+					InitializeAndStreamFrameData(AnimationData, StreamTime);
+					return;
+				}
+				AnimationData.PropertyValues.Empty();
+				AnimationData.WorldTime = StreamTime;
+				MayaLiveLinkStreamManager::TheOne().OnStreamAnimSequenceSubject(LiveLinkSubjectName);
 			};
 
 			auto StartFrame = MAnimControl::minTime();
 			auto EndFrame = MAnimControl::maxTime();
 			const int NumberOfFrames = static_cast<int>((EndFrame - StartFrame).as(MTime::uiUnit())) + 1;
-			if (StreamFullAnimSequence)
+			if (MayaLiveLinkStreamManager::TheOne().IsAnimSequenceTrackLayout())
 			{
-				FMayaLiveLinkAnimSequenceFrameData& AnimationData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkAnimSequenceFrameData>();
+				// Track-major layout: each channel is a single array indexed [track * NumFrames + frame]
+				int TrackBoneIndex = 0;
+				int TrackCurveIndex = 0;
+				auto AddTrackLambda = [&TrackBoneIndex](FMayaLiveLinkAnimSequenceTrackFrameData& AnimationData, int FrameIndex, const FTransform& Transform)
+				{
+					const int32 Index = AnimationData.GetIndex(TrackBoneIndex++, FrameIndex);
+					AnimationData.Locations[Index] = Transform.GetLocation();
+					AnimationData.Rotations[Index] = Transform.GetRotation();
+					AnimationData.Scales[Index] = Transform.GetScale3D();
+				};
+				auto AddTrackBlendShapeWeightsLambda = [&TrackCurveIndex](FMayaLiveLinkAnimSequenceTrackFrameData& AnimationData, int FrameIndex, const TArray<float>& CurvesValue)
+				{
+					for (float CurveValue : CurvesValue)
+					{
+						AnimationData.CurveValues[AnimationData.GetIndex(TrackCurveIndex++, FrameIndex)] = CurveValue;
+					}
+				};
+				auto AddTrackDynamicPlugLambda = [&TrackCurveIndex](FMayaLiveLinkAnimSequenceTrackFrameData& AnimationData, int FrameIndex, float val)
+				{
+					AnimationData.CurveValues[AnimationData.GetIndex(TrackCurveIndex++, FrameIndex)] = val;
+				};
 
-				int NumberOfFramesToReserve = NumberOfFrames;
+				int FirstFrame = 0;
+				int NumberOfFramesToStream = NumberOfFrames;
+				if (!StreamFullAnimSequence)
+				{
+					// Round the offset from the start of the range so a fractional start frame does not shift the key by one
+					FirstFrame = FMath::RoundToInt((MAnimControl::currentTime() - StartFrame).as(MTime::uiUnit()));
+					if (FirstFrame < 0 || FirstFrame >= NumberOfFrames)
+					{
+						return;
+					}
+					NumberOfFramesToStream = 1;
+				}
+
+				const int EndFrameIndex = FirstFrame + NumberOfFramesToStream;
 				auto MayaTime = StartFrame;
 				int LastPercentage = -1;
-				for (int Index = 0; Index < NumberOfFrames; ++Index, MayaTime += 1)
+				for (int ChunkStart = FirstFrame; ChunkStart < EndFrameIndex; ChunkStart += AnimSequenceChunkSize)
 				{
-					MDGContext timeContext(MayaTime);
-					MDGContextGuard ContextGuard(timeContext);
-					ReserveLambda(AnimationData, 0, NumberOfFramesToReserve, JointsToStreamLen);
-					BuildFrameData<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddLambda, InverseScales, Index);
-					BuildBlendShapeWeights<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddBlendShapeWeightsLambda, Index);
-					BuildDynamicPlugValues<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddDynamicPlugLambda, Index);
+					const int ChunkSize = std::min(AnimSequenceChunkSize, EndFrameIndex - ChunkStart);
 
-					// Reserve memory only on the first frame
-					NumberOfFramesToReserve = -1;
+					FMayaLiveLinkAnimSequenceTrackFrameData& AnimationData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkAnimSequenceTrackFrameData>();
+					AnimationData.Initialize(ChunkStart,
+											 ChunkSize,
+											 static_cast<int32>(JointsToStreamLen),
+											 static_cast<int32>(CurveNames.length() + DynamicPlugs.length()));
 
-					MayaLiveLinkStreamManager::TheOne().UpdateProgressBar(Index, NumberOfFrames, LastPercentage);
+					for (int Index = 0; Index < ChunkSize; ++Index, MayaTime += 1)
+					{
+						TrackBoneIndex = 0;
+						TrackCurveIndex = 0;
+						if (StreamFullAnimSequence)
+						{
+							MDGContext timeContext(MayaTime);
+							MDGContextGuard ContextGuard(timeContext);
+							BuildFrameData<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackLambda, InverseScales, Index);
+							BuildBlendShapeWeights<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackBlendShapeWeightsLambda, Index);
+							BuildDynamicPlugValues<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackDynamicPlugLambda, Index);
 
-					InverseScales.clear();
+							MayaLiveLinkStreamManager::TheOne().UpdateProgressBar(ChunkStart + Index, NumberOfFrames, LastPercentage);
+						}
+						else
+						{
+							BuildFrameData<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackLambda, InverseScales, Index);
+							BuildBlendShapeWeights<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackBlendShapeWeightsLambda, Index);
+							BuildDynamicPlugValues<FMayaLiveLinkAnimSequenceTrackFrameData>(AnimationData, AddTrackDynamicPlugLambda, Index);
+						}
+
+						InverseScales.clear();
+					}
+
+					StreamChunk(AnimationData, ChunkStart + ChunkSize >= EndFrameIndex, StreamTime);
 				}
 
-				// TODO: need to optimize using the anim cache playback telling which frames changed instead
 				StreamFullAnimSequence = false;
+			}
+			else if (StreamFullAnimSequence)
+			{
+				auto MayaTime = StartFrame;
+				int LastPercentage = -1;
+				for (int ChunkStart = 0; ChunkStart < NumberOfFrames; ChunkStart += AnimSequenceChunkSize)
+				{
+					const int ChunkSize = std::min(AnimSequenceChunkSize, NumberOfFrames - ChunkStart);
 
-				InitializeAndStreamFrameData(AnimationData, StreamTime);
+					FMayaLiveLinkAnimSequenceFrameData& AnimationData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkAnimSequenceFrameData>();
+					ReserveLambda(AnimationData, ChunkStart, ChunkSize, JointsToStreamLen);
+
+					for (int Index = 0; Index < ChunkSize; ++Index, MayaTime += 1)
+					{
+						MDGContext timeContext(MayaTime);
+						MDGContextGuard ContextGuard(timeContext);
+						BuildFrameData<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddLambda, InverseScales, Index);
+						BuildBlendShapeWeights<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddBlendShapeWeightsLambda, Index);
+						BuildDynamicPlugValues<FMayaLiveLinkAnimSequenceFrameData>(AnimationData, AddDynamicPlugLambda, Index);
+
+						MayaLiveLinkStreamManager::TheOne().UpdateProgressBar(ChunkStart + Index, NumberOfFrames, LastPercentage);
+
+						InverseScales.clear();
+					}
+
+					StreamChunk(AnimationData, ChunkStart + ChunkSize >= NumberOfFrames, StreamTime);
+				}
+
+				// TODO: need to optimize using the anim cache playback telling which frames changed instead
+				StreamFullAnimSequence = false;
 			}
 			else
 			{
@@ -614,7 +675,7 @@ void MLiveLinkJointHierarchySubject::OnStream(double StreamTime, double CurrentT
 
 			AnimFrameData.WorldTime = StreamTime;
 			AnimFrameData.MetaData.SceneTime = SceneTime;
-			MayaLiveLinkStreamManager::TheOne().OnStreamJointHierarchySubject(SubjectName, "FullHierarchy");
+			MayaLiveLinkStreamManager::TheOne().OnStreamJointHierarchySubject(LiveLinkSubjectName, EStreamRole::Animation);
 		}
 	}
 }
@@ -622,8 +683,9 @@ void MLiveLinkJointHierarchySubject::OnStream(double StreamTime, double CurrentT
 template<typename T, typename F>
 void MLiveLinkJointHierarchySubject::BuildBlendShapeWeights(T& AnimationData, F& AddLambda, int FrameIndex)
 {
+	const unsigned int CurveNamesLen = CurveNames.length();
 	TArray<float> CurvesValue;
-	CurvesValue.Init(0.0f, CurveNames.length());
+	CurvesValue.Init(0.0f, CurveNamesLen);
 	MStatus Status;
 
 	// Iterate through the objects associate with the character that has blend shape on it
@@ -650,6 +712,23 @@ void MLiveLinkJointHierarchySubject::BuildBlendShapeWeights(T& AnimationData, F&
 				// For every weight of a blendshape, compute recursively the parent directories weights
 				// and multiply them with the actual weight
 				for (unsigned int IdxWeight = 0; IdxWeight < WeightPlug.numElements(); IdxWeight++) {
+					// Find the index corresponding to the curve we want to stream.
+					// Weights excluded by the streaming mask are not part of CurveNames and are not evaluated.
+					MString WeightName = MayaUnrealLiveLinkUtils::GetPlugAliasName(WeightPlug[IdxWeight]);
+					unsigned int IndexFind = CurveNamesLen;
+					for (unsigned int i = 0; i < CurveNamesLen; i++)
+					{
+						if (CurveNames[i] == WeightName)
+						{
+							IndexFind = i;
+							break;
+						}
+					}
+					if (IndexFind >= CurveNamesLen)
+					{
+						continue;
+					}
+
 					// Parent visibility
 					MPlug CurrentTargetParentVisibilityPlug = TargetParentVisibilityPlug[IdxWeight];
 					bool IsCurrentTargetParentVisible = CurrentTargetParentVisibilityPlug.asBool(&Status);
@@ -699,21 +778,7 @@ void MLiveLinkJointHierarchySubject::BuildBlendShapeWeights(T& AnimationData, F&
 					}
 
 					//// Insert the real weight value in the index corresponding to the curve we want to stream
-					MString WeightName = MayaUnrealLiveLinkUtils::GetPlugAliasName(WeightPlug[IdxWeight]);
-					unsigned int IndexFind = 0;
-					for (unsigned int i = 0; i < CurveNames.length(); i++)
-					{
-						if (CurveNames[i] == WeightName)
-						{
-							IndexFind = i;
-							break;
-						}
-					}
-
-					if (IndexFind >= 0 && IndexFind < CurveNames.length())
-					{
-						CurvesValue[IndexFind] = ActualWeightValue;
-					} 
+					CurvesValue[IndexFind] = ActualWeightValue;
 				}
 			}
 		}
@@ -750,11 +815,18 @@ void MLiveLinkJointHierarchySubject::BuildFrameData(T& AnimationData,
 	{
 		const MStreamHierarchy& H = JointsToStream[Idx];
 
-		const MFnTransform& TransformObject = H.IsTransform ? H.TransformObject : H.JointObject;
+		// A deleted node streams an identity transform until the hierarchy is rebuilt
+		if (!H.IsValid())
+		{
+			InverseScales.emplace_back(MMatrix::identity);
+			MMatrix IdentityMatrix;
+			AddLambda(AnimationData, FrameIndex, MayaUnrealLiveLinkUtils::BuildUETransformFromMayaTransform(IdentityMatrix));
+			continue;
+		}
 
-		MTransformationMatrix::RotationOrder RotOrder = TransformObject.rotationOrder();
+		const MTransformationMatrix::RotationOrder RotOrder = H.GetRotationOrder();
 
-		MMatrix JointScale = MayaUnrealLiveLinkUtils::GetScale(TransformObject);
+		MMatrix JointScale = H.GetScale();
 		InverseScales.emplace_back(JointScale.inverse());
 
 		MMatrix ParentInverseScale = (H.ParentIndex == -1) ? MMatrix::identity : InverseScales[H.ParentIndex];
@@ -763,18 +835,18 @@ void MLiveLinkJointHierarchySubject::BuildFrameData(T& AnimationData,
 		if (!H.IsTransform)
 		{
 			MayaSpaceJointMatrix = JointScale *
-				MayaUnrealLiveLinkUtils::GetRotationOrientation(H.JointObject, RotOrder) *
-				MayaUnrealLiveLinkUtils::GetRotation(TransformObject, RotOrder) *
-				MayaUnrealLiveLinkUtils::GetJointOrientation(H.JointObject, RotOrder) *
+				H.GetRotationOrientation() *
+				H.GetRotation(RotOrder) *
+				H.GetJointOrientation() *
 				ParentInverseScale *
-				MayaUnrealLiveLinkUtils::GetTranslation(TransformObject);
+				H.GetTranslation();
 		}
 		else
 		{
 			MayaSpaceJointMatrix = JointScale *
-				MayaUnrealLiveLinkUtils::GetRotation(TransformObject, RotOrder) *
+				H.GetRotation(RotOrder) *
 				ParentInverseScale *
-				MayaUnrealLiveLinkUtils::GetTranslation(TransformObject);
+				H.GetTranslation();
 		}
 
 		if (Idx == 0 && MGlobal::isYAxisUp()) // rotate the root joint to get the correct character rotation in Unreal
@@ -815,6 +887,80 @@ int MLiveLinkJointHierarchySubject::GetStreamType() const
 	return StreamMode;
 }
 
+void MLiveLinkJointHierarchySubject::SetStreamMask(const MStringArray& ExcludedJointsIn, const MStringArray& ExcludedCurvesIn)
+{
+	auto IsSameArray = [](const MStringArray& A, const MStringArray& B)
+	{
+		if (A.length() != B.length())
+		{
+			return false;
+		}
+		for (unsigned int Index = 0; Index < A.length(); ++Index)
+		{
+			if (A[Index] != B[Index])
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	if (IsSameArray(ExcludedJoints, ExcludedJointsIn) && IsSameArray(ExcludedCurves, ExcludedCurvesIn))
+	{
+		return;
+	}
+
+	ExcludedJoints = ExcludedJointsIn;
+	ExcludedCurves = ExcludedCurvesIn;
+
+	// The static data (bone and property names) changes with the mask
+	StreamFullAnimSequence = true;
+	RebuildSubjectData();
+}
+
+void MLiveLinkJointHierarchySubject::GetStreamMask(MStringArray& ExcludedJointsOut, MStringArray& ExcludedCurvesOut) const
+{
+	ExcludedJointsOut = ExcludedJoints;
+	ExcludedCurvesOut = ExcludedCurves;
+}
+
+bool MLiveLinkJointHierarchySubject::IsJointExcluded(const MDagPath& JointPath) const
+{
+	const unsigned int ExcludedJointsLen = ExcludedJoints.length();
+	if (ExcludedJointsLen == 0 || JointPath == RootDagPath)
+	{
+		return false;
+	}
+
+	// Match either the full DAG path or the node name without its namespace
+	const MString FullPathName = JointPath.fullPathName();
+	const MString JointName(TCHAR_TO_ANSI(*MayaUnrealLiveLinkUtils::StripMayaNamespace(MFnDagNode(JointPath).name())));
+	for (unsigned int Index = 0; Index < ExcludedJointsLen; ++Index)
+	{
+		const MString& ExcludedJoint = ExcludedJoints[Index];
+		if (ExcludedJoint == JointName || ExcludedJoint == FullPathName)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool MLiveLinkJointHierarchySubject::IsCurveExcluded(const MString& CurveName, const MString& GroupName) const
+{
+	const unsigned int ExcludedCurvesLen = ExcludedCurves.length();
+	for (unsigned int Index = 0; Index < ExcludedCurvesLen; ++Index)
+	{
+		const MString& ExcludedCurve = ExcludedCurves[Index];
+		if ((CurveName.length() != 0 && ExcludedCurve == CurveName) ||
+			(GroupName.length() != 0 && ExcludedCurve == GroupName))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 void MLiveLinkJointHierarchySubject::OnAttributeChanged(const MObject& Object, const MPlug& Plug, const MPlug& OtherPlug)
 {
 	if (Object.isNull())
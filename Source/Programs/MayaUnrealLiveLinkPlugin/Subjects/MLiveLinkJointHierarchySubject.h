@@ -85,6 +85,10 @@ public:
 	virtual void UnlinkUnrealAsset() override;
 	virtual void SetBakeUnrealAsset(bool shouldBakeCurves) override;
 
+	virtual bool SupportsStreamMask() const override { return true; }
+	virtual void SetStreamMask(const MStringArray& ExcludedJointsIn, const MStringArray& ExcludedCurvesIn) override;
+	virtual void GetStreamMask(MStringArray& ExcludedJointsOut, MStringArray& ExcludedCurvesOut) const override;
+
 	virtual bool ShouldBakeTransform() const override;
 
 private:
@@ -100,9 +104,14 @@ private:
 	template<typename T, typename F>
 	void BuildDynamicPlugValues(T& AnimationData, F& AddLambda, int FrameIndex);
 
+	// Is the joint the root of a sub-tree excluded by the streaming mask
+	bool IsJointExcluded(const MDagPath& JointPath) const;
+	// Is the curve excluded by the streaming mask, either by name or through its group (i.e. blend shape node)
+	bool IsCurveExcluded(const MString& CurveName, const MString& GroupName = MString()) const;
 
 private:
 	MString SubjectName;
+	FName LiveLinkSubjectName;
 	std::vector<MStreamHierarchy> JointsToStream;
 	MStringArray CurveNames;
 	std::vector<MObject> BlendShapeObjects;
@@ -118,4 +127,8 @@ private:
 	bool StreamFullAnimSequence;
 	bool ForceLinkAsset;
 	bool ShouldBakeCurves = false;
+
+	// Streaming mask
+	MStringArray ExcludedJoints;
+	MStringArray ExcludedCurves;
 };
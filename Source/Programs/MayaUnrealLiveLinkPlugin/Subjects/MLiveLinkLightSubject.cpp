@@ -38,6 +38,7 @@ const MStringArray MLiveLinkLightSubject::LightStreamOptions(LightStreams, 3);
 MLiveLinkLightSubject::MLiveLinkLightSubject(const MString& InSubjectName, const MDagPath& InRootPath, MLightStreamMode InStreamMode)
 : IMStreamedEntity(InRootPath)
 , SubjectName(InSubjectName)
+, LiveLinkSubjectName(InSubjectName.asChar())
 , StreamMode(InStreamMode >= 0 && InStreamMode < LightStreamOptions.length() ? InStreamMode : MLightStreamMode::Light)
 , bLinked(false)
 {
@@ -87,12 +88,12 @@ bool MLiveLinkLightSubject::RebuildSubjectData(bool ForceRelink)
 	if (StreamMode == MLightStreamMode::RootOnly)
 	{
 		MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkTransformStaticData>();
-		return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(SubjectName, "RootOnly");
+		return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(LiveLinkSubjectName, EStreamRole::Transform);
 	}
 	else if (StreamMode == MLightStreamMode::FullHierarchy)
 	{
 		MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkSkeletonStaticData>();
-		return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(SubjectName, "FullHierarchy");
+		return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(LiveLinkSubjectName, EStreamRole::Animation);
 	}
 	else if (StreamMode == MLightStreamMode::Light)
 	{
@@ -101,7 +102,7 @@ bool MLiveLinkLightSubject::RebuildSubjectData(bool ForceRelink)
 			auto& LightData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkLightStaticData>();
 			LightData.bIsInnerConeAngleSupported = IsSpotLight;
 			LightData.bIsOuterConeAngleSupported = IsSpotLight;
-			return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(SubjectName, "Light");
+			return MayaLiveLinkStreamManager::TheOne().RebuildLightSubjectData(LiveLinkSubjectName, EStreamRole::Light);
 		}
 		else
 		{
@@ -129,7 +130,7 @@ void MLiveLinkLightSubject::OnStream(double StreamTime, double CurrentTime)
 		TransformFrameData.WorldTime = StreamTime;
 		TransformFrameData.MetaData.SceneTime = SceneTime;
 
-		MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(SubjectName, "RootOnly");
+		MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(LiveLinkSubjectName, EStreamRole::Transform);
 	}
 	else if (StreamMode == MLightStreamMode::FullHierarchy)
 	{
@@ -138,7 +139,7 @@ void MLiveLinkLightSubject::OnStream(double StreamTime, double CurrentTime)
 		AnimationData.WorldTime = StreamTime;
 		AnimationData.MetaData.SceneTime = SceneTime;
 
-		MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(SubjectName, "FullHierarchy");
+		MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(LiveLinkSubjectName, EStreamRole::Animation);
 	}
 	else if (StreamMode == MLightStreamMode::Light)
 	{
@@ -169,7 +170,7 @@ void MLiveLinkLightSubject::OnStream(double StreamTime, double CurrentTime)
 				}
 				LightFrameData.OuterConeAngle = static_cast<float>(MayaUnrealLiveLinkUtils::RadToDeg(outerAngle));
 			}
-			MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(SubjectName, "Light");
+			MayaLiveLinkStreamManager::TheOne().OnStreamLightSubject(LiveLinkSubjectName, EStreamRole::Light);
 		}
 		else
 		{
@@ -178,7 +179,7 @@ void MLiveLinkLightSubject::OnStream(double StreamTime, double CurrentTime)
 				auto& FrameData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkLevelSequenceFrameData>();
 				InitializeFrameData(FrameData);
 				AnimCurves.clear();
-				MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(SubjectName);
+				MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(LiveLinkSubjectName);
 			}
 		}
 	}
@@ -74,6 +74,7 @@ public:
 
 private:
 	MString SubjectName;
+	FName LiveLinkSubjectName;
 
 	MLightStreamMode StreamMode;
 
@@ -29,6 +29,7 @@
 MLiveLinkPropSubject::MLiveLinkPropSubject(const MString& InSubjectName, const MDagPath& InRootPath, MPropStreamMode InStreamMode)
 : IMStreamedEntity(InRootPath)
 , SubjectName(InSubjectName)
+, LiveLinkSubjectName(InSubjectName.asChar())
 , StreamMode(InStreamMode >= 0 && InStreamMode < PropStreamOptions.length() ? InStreamMode : MPropStreamMode::RootOnly)
 , bLinked(false)
 {
@@ -80,7 +81,7 @@ bool MLiveLinkPropSubject::RebuildSubjectData(bool ForceRelink)
 		if (!IsLinked())
 		{
 			MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FLiveLinkTransformStaticData>();
-			return MayaLiveLinkStreamManager::TheOne().RebuildPropSubjectData(SubjectName, "RootOnly");
+			return MayaLiveLinkStreamManager::TheOne().RebuildPropSubjectData(LiveLinkSubjectName, EStreamRole::Transform);
 		}
 		else
 		{
@@ -107,7 +108,7 @@ bool MLiveLinkPropSubject::RebuildSubjectData(bool ForceRelink)
 			}
 		}
 
-		return MayaLiveLinkStreamManager::TheOne().RebuildPropSubjectData(SubjectName, "FullHierarchy");
+		return MayaLiveLinkStreamManager::TheOne().RebuildPropSubjectData(LiveLinkSubjectName, EStreamRole::Animation);
 	}
 	return false;
 }
@@ -148,7 +149,7 @@ void MLiveLinkPropSubject::OnStream(double StreamTime, double CurrentTime)
 			TransformData.WorldTime = StreamTime;
 			TransformData.MetaData.SceneTime = SceneTime;
 
-			MayaLiveLinkStreamManager::TheOne().OnStreamPropSubject(SubjectName, "RootOnly");
+			MayaLiveLinkStreamManager::TheOne().OnStreamPropSubject(LiveLinkSubjectName, EStreamRole::Transform);
 		}
 		else
 		{
@@ -157,7 +158,7 @@ void MLiveLinkPropSubject::OnStream(double StreamTime, double CurrentTime)
 				auto& FrameData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetFrameDataFromUnreal<FMayaLiveLinkLevelSequenceFrameData>();
 				InitializeFrameData(FrameData);
 				AnimCurves.clear();
-				MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(SubjectName);
+				MayaLiveLinkStreamManager::TheOne().OnStreamLevelSequenceSubject(LiveLinkSubjectName);
 			}
 		}
 	}
@@ -175,7 +176,7 @@ void MLiveLinkPropSubject::OnStream(double StreamTime, double CurrentTime)
 			AnimationData.PropertyValues.Add(Plug.asFloat());
 		}
 
-		MayaLiveLinkStreamManager::TheOne().OnStreamPropSubject(SubjectName, "FullHierarchy");
+		MayaLiveLinkStreamManager::TheOne().OnStreamPropSubject(LiveLinkSubjectName, EStreamRole::Animation);
 	}
 }
 
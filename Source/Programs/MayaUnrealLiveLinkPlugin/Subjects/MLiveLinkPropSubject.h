@@ -74,6 +74,7 @@ public:
 
 private:
 	MString SubjectName;
+	FName LiveLinkSubjectName;
 
 	MPlugArray DynamicPlugs;
 	MPropStreamMode StreamMode;
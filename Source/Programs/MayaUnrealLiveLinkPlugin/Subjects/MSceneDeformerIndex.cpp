@@ -0,0 +1,429 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MSceneDeformerIndex.h"
+
+#include <algorithm>
+
+THIRD_PARTY_INCLUDES_START
+#include <maya/MDagPath.h>
+#include <maya/MDagPathArray.h>
+#include <maya/MFnBlendShapeDeformer.h>
+#include <maya/MFnDagNode.h>
+#include <maya/MFnDependencyNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MFnSkinCluster.h>
+#include <maya/MItDependencyNodes.h>
+#include <maya/MObjectArray.h>
+#include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+void AddUnique(const MObject& Object, std::vector<MObject>& Objects)
+{
+	if (std::find(Objects.begin(), Objects.end(), Object) == Objects.end())
+	{
+		Objects.emplace_back(Object);
+	}
+}
+}
+
+MSceneDeformerIndex& MSceneDeformerIndex::TheOne()
+{
+	static MSceneDeformerIndex SSceneDeformerIndex;
+	return SSceneDeformerIndex;
+}
+
+void MSceneDeformerIndex::Rebuild()
+{
+	Reset();
+
+	for (auto Type : { MFn::kSkinClusterFilter, MFn::kBlendShape, MFn::kHikIKEffector })
+	{
+		for (MItDependencyNodes Iterator(Type); !Iterator.isDone(); Iterator.next())
+		{
+			IndexNode(Iterator.thisNode());
+		}
+	}
+
+	bBuilt = true;
+}
+
+void MSceneDeformerIndex::Reset()
+{
+	SkinClustersByInfluence.clear();
+	BlendShapesByBaseObject.clear();
+	BlendShapesBySkinInfluence.clear();
+	UnskinnedBlendShapes.clear();
+	HikIKEffectorsByCharacter.clear();
+	PendingNodes.clear();
+	bBuilt = false;
+	bPurgeNeeded = false;
+}
+
+void MSceneDeformerIndex::OnNodeAdded(const MObject& Node)
+{
+	// Connections are not made yet when a node is added, index it on the next lookup
+	if (bBuilt)
+	{
+		PendingNodes.emplace_back(Node);
+	}
+}
+
+void MSceneDeformerIndex::OnNodeRemoved(const MObject& Node)
+{
+	// Entries of removed nodes are skipped by the lookups and purged in one go on the next update
+	if (bBuilt)
+	{
+		bPurgeNeeded = true;
+	}
+}
+
+void MSceneDeformerIndex::Update()
+{
+	if (!bBuilt)
+	{
+		Rebuild();
+		return;
+	}
+
+	if (bPurgeNeeded)
+	{
+		Purge();
+	}
+
+	if (!PendingNodes.empty())
+	{
+		// Index the nodes added since the last lookup
+		std::vector<MObjectHandle> Nodes;
+		Nodes.swap(PendingNodes);
+		for (const auto& Handle : Nodes)
+		{
+			if (Handle.isValid())
+			{
+				IndexNode(Handle.object());
+			}
+		}
+	}
+}
+
+void MSceneDeformerIndex::Purge()
+{
+	auto PurgeMap = [](MHandleMultimap& Map)
+	{
+		for (auto It = Map.begin(); It != Map.end();)
+		{
+			if (!It->second.first.isValid() || !It->second.second.isValid())
+			{
+				It = Map.erase(It);
+			}
+			else
+			{
+				++It;
+			}
+		}
+	};
+	PurgeMap(SkinClustersByInfluence);
+	PurgeMap(BlendShapesByBaseObject);
+	PurgeMap(BlendShapesBySkinInfluence);
+	PurgeMap(HikIKEffectorsByCharacter);
+
+	UnskinnedBlendShapes.erase(std::remove_if(UnskinnedBlendShapes.begin(),
+											  UnskinnedBlendShapes.end(),
+											  [](const MObjectHandle& Handle) { return !Handle.isValid(); }),
+							   UnskinnedBlendShapes.end());
+
+	bPurgeNeeded = false;
+}
+
+void MSceneDeformerIndex::IndexNode(const MObject& Node)
+{
+	if (Node.hasFn(MFn::kSkinClusterFilter))
+	{
+		IndexSkinCluster(Node);
+	}
+	else if (Node.hasFn(MFn::kBlendShape))
+	{
+		IndexBlendShape(Node);
+	}
+	else if (Node.hasFn(MFn::kHikIKEffector))
+	{
+		IndexHikIKEffector(Node);
+	}
+}
+
+void MSceneDeformerIndex::IndexSkinCluster(const MObject& SkinClusterObject)
+{
+	MFnSkinCluster SkinCluster(SkinClusterObject);
+
+	MDagPathArray InfluenceObjectPaths;
+	const unsigned int NumInfluenceObjects = SkinCluster.influenceObjects(InfluenceObjectPaths);
+	for (unsigned int IdxInfluenceObject = 0; IdxInfluenceObject < NumInfluenceObjects; ++IdxInfluenceObject)
+	{
+		Insert(SkinClustersByInfluence, InfluenceObjectPaths[IdxInfluenceObject].node(), SkinClusterObject);
+	}
+
+	// A skin cluster added after a blend shape changes how this blend shape is associated with the subjects.
+	// This is only needed when maintaining the index, a rebuild indexes every blend shape anyway.
+	if (!bBuilt)
+	{
+		return;
+	}
+
+	std::vector<MObject> BlendShapes;
+	const unsigned int NumGeoms = SkinCluster.numOutputConnections();
+	for (unsigned int IdxGeoms = 0; IdxGeoms < NumGeoms; ++IdxGeoms)
+	{
+		MDagPath GeometryPath;
+		SkinCluster.getPathAtIndex(SkinCluster.indexForOutputConnection(IdxGeoms), GeometryPath);
+		Find(BlendShapesByBaseObject, GeometryPath.node(), BlendShapes);
+	}
+	for (const auto& BlendShape : BlendShapes)
+	{
+		IndexBlendShape(BlendShape);
+	}
+}
+
+void MSceneDeformerIndex::IndexBlendShape(const MObject& BlendShapeObject)
+{
+	MStatus Status;
+	MFnBlendShapeDeformer BlendShape(BlendShapeObject);
+
+	// A blend shape is indexed again when a skin cluster is added to its mesh, forget how it was indexed before
+	if (bBuilt)
+	{
+		RemoveValue(BlendShapesByBaseObject, BlendShapeObject);
+		RemoveValue(BlendShapesBySkinInfluence, BlendShapeObject);
+		UnskinnedBlendShapes.erase(std::remove(UnskinnedBlendShapes.begin(), UnskinnedBlendShapes.end(), MObjectHandle(BlendShapeObject)),
+								   UnskinnedBlendShapes.end());
+	}
+
+	// The base objects are the shapes that are to be deformed
+	MObjectArray BaseObjects;
+	BlendShape.getBaseObjects(BaseObjects);
+	const MString InMeshString("inMesh");
+	bool Unskinned = false;
+
+	for (unsigned int IdxBaseObject = 0; IdxBaseObject < BaseObjects.length(); ++IdxBaseObject)
+	{
+		const auto& BaseObject = BaseObjects[IdxBaseObject];
+		Insert(BlendShapesByBaseObject, BaseObject, BlendShapeObject);
+
+		if (!BaseObject.hasFn(MFn::kMesh))
+		{
+			continue;
+		}
+
+		MFnMesh Mesh(BaseObject);
+		auto InMeshPlug = Mesh.findPlug(InMeshString, true, &Status);
+		if (!Status)
+		{
+			continue;
+		}
+
+		// A blend shape on a skinned mesh belongs to the subjects parenting the influence objects,
+		// otherwise it is associated with every subject.
+		MPlugArray PlugArray;
+		InMeshPlug.connectedTo(PlugArray, true, false);
+		for (unsigned int i = 0; i < PlugArray.length(); ++i)
+		{
+			auto PlugNode = PlugArray[i].node();
+			if (PlugNode.hasFn(MFn::kSkinClusterFilter))
+			{
+				MFnSkinCluster SkinCluster(PlugNode);
+				MDagPathArray InfluenceObjectPaths;
+				const unsigned int NumInfluenceObjects = SkinCluster.influenceObjects(InfluenceObjectPaths);
+				for (unsigned int Dag = 0; Dag < NumInfluenceObjects; ++Dag)
+				{
+					Insert(BlendShapesBySkinInfluence, InfluenceObjectPaths[Dag].node(), BlendShapeObject);
+				}
+			}
+			else
+			{
+				Unskinned = true;
+			}
+		}
+	}
+
+	if (Unskinned)
+	{
+		UnskinnedBlendShapes.emplace_back(BlendShapeObject);
+	}
+}
+
+void MSceneDeformerIndex::IndexHikIKEffector(const MObject& HikIKEffectorObject)
+{
+	// Keyed on the character node rather than its name so that renaming the character doesn't invalidate the index
+	std::vector<MObject> Characters;
+	GetHikIKEffectorCharacters(HikIKEffectorObject, Characters);
+	for (const auto& Character : Characters)
+	{
+		Insert(HikIKEffectorsByCharacter, Character, HikIKEffectorObject);
+	}
+}
+
+void MSceneDeformerIndex::Insert(MHandleMultimap& Map, const MObject& Key, const MObject& Value)
+{
+	MObjectHandle KeyHandle(Key);
+	Map.emplace(KeyHandle.hashCode(), std::make_pair(KeyHandle, MObjectHandle(Value)));
+}
+
+void MSceneDeformerIndex::RemoveValue(MHandleMultimap& Map, const MObject& Value)
+{
+	MObjectHandle ValueHandle(Value);
+	for (auto It = Map.begin(); It != Map.end();)
+	{
+		if (It->second.second == ValueHandle)
+		{
+			It = Map.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+void MSceneDeformerIndex::Find(const MHandleMultimap& Map, const MObject& Key, std::vector<MObject>& Values)
+{
+	MObjectHandle KeyHandle(Key);
+	auto Range = Map.equal_range(KeyHandle.hashCode());
+	for (auto It = Range.first; It != Range.second; ++It)
+	{
+		// Hash codes can collide, make sure it's the same node
+		if (It->second.first == KeyHandle && It->second.second.isValid())
+		{
+			AddUnique(It->second.second.object(), Values);
+		}
+	}
+}
+
+void MSceneDeformerIndex::GetSkinnedGeometries(const std::vector<MObject>& Influences, std::vector<MObject>& Geometries)
+{
+	Update();
+
+	std::vector<MObject> SkinClusters;
+	for (const auto& Influence : Influences)
+	{
+		Find(SkinClustersByInfluence, Influence, SkinClusters);
+	}
+
+	for (const auto& SkinClusterObject : SkinClusters)
+	{
+		MFnSkinCluster SkinCluster(SkinClusterObject);
+
+		// Loop through the geometries affected by this skin cluster
+		const unsigned int NumGeoms = SkinCluster.numOutputConnections();
+		for (unsigned int IdxGeoms = 0; IdxGeoms < NumGeoms; ++IdxGeoms)
+		{
+			MDagPath GeometryPath;
+			SkinCluster.getPathAtIndex(SkinCluster.indexForOutputConnection(IdxGeoms), GeometryPath);
+			AddUnique(GeometryPath.node(), Geometries);
+		}
+	}
+}
+
+void MSceneDeformerIndex::GetBlendShapesDeforming(const std::vector<MObject>& Meshes, std::vector<MObject>& BlendShapes)
+{
+	Update();
+
+	for (const auto& Mesh : Meshes)
+	{
+		Find(BlendShapesByBaseObject, Mesh, BlendShapes);
+	}
+}
+
+void MSceneDeformerIndex::GetBlendShapesForSubject(const MObject& SubjectObject, std::vector<MObject>& BlendShapes)
+{
+	Update();
+
+	for (const auto& Handle : UnskinnedBlendShapes)
+	{
+		if (Handle.isValid())
+		{
+			AddUnique(Handle.object(), BlendShapes);
+		}
+	}
+
+	// Skinned blend shapes are associated with the subject when one of their influence objects is a child of the subject
+	MStatus Status;
+	MFnDagNode SubjectNode(SubjectObject, &Status);
+	if (!Status)
+	{
+		return;
+	}
+
+	const unsigned int NumChildren = SubjectNode.childCount();
+	for (unsigned int IdxChild = 0; IdxChild < NumChildren; ++IdxChild)
+	{
+		Find(BlendShapesBySkinInfluence, SubjectNode.child(IdxChild), BlendShapes);
+	}
+}
+
+void MSceneDeformerIndex::GetHikIKEffectors(const MObject& CharacterObject, std::vector<MObject>& Effectors)
+{
+	Update();
+
+	Find(HikIKEffectorsByCharacter, CharacterObject, Effectors);
+}
+
+void MSceneDeformerIndex::GetHikIKEffectorCharacters(const MObject& HikIKEffectorObject, std::vector<MObject>& Characters)
+{
+	MStatus Status;
+	MFnDependencyNode HikIKEffector(HikIKEffectorObject, &Status);
+	if (!Status)
+	{
+		return;
+	}
+
+	// Get the control set plug which will refer to the control rig
+	auto ControlSetPlug = HikIKEffector.findPlug("ControlSet", true, &Status);
+	if (!Status)
+	{
+		return;
+	}
+
+	// Get the source plugs connected to the control set
+	MPlugArray ControlSetPlugSrcs;
+	ControlSetPlug.connectedTo(ControlSetPlugSrcs, false, true);
+	if (ControlSetPlugSrcs.length() == 0)
+	{
+		return;
+	}
+
+	// Get the control rig node and find the InputCharacterDefinition plug which will refer a HIKCharacter node
+	MFnDependencyNode ControlRigNode(ControlSetPlugSrcs[0].node());
+	auto ICDPlug = ControlRigNode.findPlug("InputCharacterDefinition", true, &Status);
+	if (!Status)
+	{
+		return;
+	}
+
+	MPlugArray ICDPlugs;
+	ICDPlug.connectedTo(ICDPlugs, true, false);
+	for (unsigned int i = 0; i < ICDPlugs.length(); ++i)
+	{
+		AddUnique(ICDPlugs[i].node(), Characters);
+	}
+}
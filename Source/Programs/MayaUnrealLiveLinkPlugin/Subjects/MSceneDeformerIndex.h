@@ -0,0 +1,101 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+THIRD_PARTY_INCLUDES_START
+#include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MString.h>
+THIRD_PARTY_INCLUDES_END
+
+// Maya specific class
+//
+// Scene-wide index of the deformers the subjects depend on: skin clusters by influence object,
+// blend shapes by deformed mesh and HumanIK effectors by character node.
+// It is built once per rebuild pass and then kept up to date from the node added/removed messages,
+// so that rebuilding a subject only does hash lookups instead of iterating over every deformer of the scene.
+class MSceneDeformerIndex
+{
+public:
+	//! Singleton object. Use this function to access it.
+	static MSceneDeformerIndex& TheOne();
+
+	//! Scan the scene and rebuild the whole index
+	void Rebuild();
+
+	//! Forget the index, it will be rebuilt on the next lookup
+	void Reset();
+
+	//! Node messages used to maintain the index between rebuild passes
+	void OnNodeAdded(const MObject& Node);
+	void OnNodeRemoved(const MObject& Node);
+
+	//! Get the geometries deformed by the skin clusters influenced by one of the objects
+	void GetSkinnedGeometries(const std::vector<MObject>& Influences, std::vector<MObject>& Geometries);
+
+	//! Get the blend shapes deforming one of the meshes
+	void GetBlendShapesDeforming(const std::vector<MObject>& Meshes, std::vector<MObject>& BlendShapes);
+
+	//! Get the blend shapes associated with a subject root
+	void GetBlendShapesForSubject(const MObject& SubjectObject, std::vector<MObject>& BlendShapes);
+
+	//! Get the HumanIK effectors driving a HIKCharacter node
+	void GetHikIKEffectors(const MObject& CharacterObject, std::vector<MObject>& Effectors);
+
+	//! Get the HIKCharacter nodes an effector is driving through its control rig
+	static void GetHikIKEffectorCharacters(const MObject& HikIKEffectorObject, std::vector<MObject>& Characters);
+
+private:
+	MSceneDeformerIndex() = default;
+
+	// Pair of key/value nodes stored by hash code of the key node
+	using MHandleMultimap = std::unordered_multimap<unsigned int, std::pair<MObjectHandle, MObjectHandle>>;
+
+	void Update();
+	void Purge();
+	void IndexNode(const MObject& Node);
+	void IndexSkinCluster(const MObject& SkinClusterObject);
+	void IndexBlendShape(const MObject& BlendShapeObject);
+	void IndexHikIKEffector(const MObject& HikIKEffectorObject);
+
+	static void Insert(MHandleMultimap& Map, const MObject& Key, const MObject& Value);
+	static void RemoveValue(MHandleMultimap& Map, const MObject& Value);
+	static void Find(const MHandleMultimap& Map, const MObject& Key, std::vector<MObject>& Values);
+
+private:
+	MHandleMultimap SkinClustersByInfluence;
+	MHandleMultimap BlendShapesByBaseObject;
+	MHandleMultimap BlendShapesBySkinInfluence;
+	std::vector<MObjectHandle> UnskinnedBlendShapes;
+	MHandleMultimap HikIKEffectorsByCharacter;
+
+	// Nodes added since the last update. They are indexed on the next lookup, once their connections are made.
+	std::vector<MObjectHandle> PendingNodes;
+
+	bool bBuilt = false;
+	bool bPurgeNeeded = false;
+};
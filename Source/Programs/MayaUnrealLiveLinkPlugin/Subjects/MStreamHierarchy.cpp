@@ -0,0 +1,118 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "MStreamHierarchy.h"
+
+THIRD_PARTY_INCLUDES_START
+#include <maya/MFnDependencyNode.h>
+#include <maya/MVector.h>
+THIRD_PARTY_INCLUDES_END
+
+extern MSpace::Space G_TransformSpace;
+
+MStreamHierarchy::MStreamHierarchy(const MString& InJointName, const MDagPath& InJointPath, int32_t InParentIndex)
+	: JointName(InJointName)
+	, JointHandle(InJointPath.node())
+	, ParentIndex(InParentIndex)
+	, IsTransform(!InJointPath.node().hasFn(MFn::kJoint))
+{
+	static const char* ChannelNames[NumChannels][3] = {
+		{ "translateX", "translateY", "translateZ" },
+		{ "rotateX", "rotateY", "rotateZ" },
+		{ "scaleX", "scaleY", "scaleZ" },
+		{ "rotateAxisX", "rotateAxisY", "rotateAxisZ" },
+		{ "jointOrientX", "jointOrientY", "jointOrientZ" },
+	};
+
+	MFnDependencyNode Node(InJointPath.node());
+	const int NumNodeChannels = IsTransform ? Scale + 1 : NumChannels;
+	for (int Channel = 0; Channel < NumNodeChannels; ++Channel)
+	{
+		for (int Axis = 0; Axis < 3; ++Axis)
+		{
+			ChannelPlugs[Channel][Axis] = Node.findPlug(ChannelNames[Channel][Axis], true);
+		}
+	}
+	RotateOrderPlug = Node.findPlug("rotateOrder", true);
+}
+
+void MStreamHierarchy::GetChannel(MChannel Channel, double Values[3]) const
+{
+	for (int Axis = 0; Axis < 3; ++Axis)
+	{
+		const MPlug& Plug = ChannelPlugs[Channel][Axis];
+		Values[Axis] = Plug.isNull() ? (Channel == Scale ? 1.0 : 0.0) : Plug.asDouble();
+	}
+}
+
+MTransformationMatrix::RotationOrder MStreamHierarchy::GetRotationOrder() const
+{
+	// The rotateOrder attribute starts at xyz while the enum starts with kInvalid
+	const short RotateOrder = RotateOrderPlug.isNull() ? 0 : RotateOrderPlug.asShort();
+	return static_cast<MTransformationMatrix::RotationOrder>(MTransformationMatrix::kXYZ + RotateOrder);
+}
+
+MMatrix MStreamHierarchy::GetScale() const
+{
+	double Scale[3];
+	GetChannel(MChannel::Scale, Scale);
+	MTransformationMatrix M;
+	M.setScale(Scale, G_TransformSpace);
+	return M.asMatrix();
+}
+
+MMatrix MStreamHierarchy::GetRotation(MTransformationMatrix::RotationOrder RotOrder) const
+{
+	double Rotation[3];
+	GetChannel(Rotate, Rotation);
+	MTransformationMatrix M;
+	M.setRotation(Rotation, RotOrder);
+	return M.asMatrix();
+}
+
+MMatrix MStreamHierarchy::GetTranslation() const
+{
+	double Translation[3];
+	GetChannel(Translate, Translation);
+	MTransformationMatrix M;
+	M.setTranslation(MVector(Translation), G_TransformSpace);
+	return M.asMatrix();
+}
+
+MMatrix MStreamHierarchy::GetRotationOrientation() const
+{
+	// The rotate axis and the joint orientation are always in xyz order
+	double ScaleOrientation[3];
+	GetChannel(RotateAxis, ScaleOrientation);
+	MTransformationMatrix M;
+	M.setRotation(ScaleOrientation, MTransformationMatrix::kXYZ);
+	return M.asMatrix();
+}
+
+MMatrix MStreamHierarchy::GetJointOrientation() const
+{
+	double JointOrientation[3];
+	GetChannel(JointOrient, JointOrientation);
+	MTransformationMatrix M;
+	M.setRotation(JointOrientation, MTransformationMatrix::kXYZ);
+	return M.asMatrix();
+}
@@ -23,33 +23,55 @@
 #pragma once
 
 THIRD_PARTY_INCLUDES_START
-#include <maya/MFnIkJoint.h>
+#include <maya/MDagPath.h>
+#include <maya/MMatrix.h>
+#include <maya/MObjectHandle.h>
+#include <maya/MPlug.h>
+#include <maya/MString.h>
+#include <maya/MTransformationMatrix.h>
 THIRD_PARTY_INCLUDES_END
 
+// Streamed joint or transform of a hierarchy.
+// Only a handle on the node and the plugs of its local channels are kept,
+// the plugs are resolved once when the hierarchy is built and read for each frame.
 class MStreamHierarchy
 {
 public:
 	MString JointName;
-	MFnIkJoint JointObject;
-	MFnTransform TransformObject;
+	MObjectHandle JointHandle;
 	int32_t ParentIndex;
 	bool IsTransform;
 
-	MStreamHierarchy() {}
-
-	MStreamHierarchy(const MStreamHierarchy& Other)
-		: JointName(Other.JointName)
-		, JointObject(Other.JointObject.dagPath())
-		, TransformObject(Other.TransformObject.dagPath())
-		, ParentIndex(Other.ParentIndex)
-		, IsTransform(Other.IsTransform)
-	{}
-
-	MStreamHierarchy(const MString& InJointName, const MDagPath& InJointPath, int32_t InParentIndex)
-		: JointName(InJointName)
-		, JointObject(InJointPath.apiType() == MFn::kTransform ? MDagPath() : InJointPath)
-		, TransformObject(InJointPath.apiType() == MFn::kTransform ? InJointPath : MDagPath())
-		, ParentIndex(InParentIndex)
-		, IsTransform(InJointPath.apiType() == MFn::kTransform)
-	{}
-};
\ No newline at end of file
+	MStreamHierarchy() : ParentIndex(-1), IsTransform(true) {}
+
+	MStreamHierarchy(const MString& InJointName, const MDagPath& InJointPath, int32_t InParentIndex);
+
+	//! The node can be deleted while the hierarchy is streamed
+	bool IsValid() const { return JointHandle.isValid(); }
+
+	MTransformationMatrix::RotationOrder GetRotationOrder() const;
+
+	MMatrix GetScale() const;
+	MMatrix GetRotation(MTransformationMatrix::RotationOrder RotOrder) const;
+	MMatrix GetTranslation() const;
+
+	//! Joint only channels
+	MMatrix GetRotationOrientation() const;
+	MMatrix GetJointOrientation() const;
+
+private:
+	enum MChannel
+	{
+		Translate,
+		Rotate,
+		Scale,
+		RotateAxis,
+		JointOrient,
+		NumChannels
+	};
+
+	void GetChannel(MChannel Channel, double Values[3]) const;
+
+	MPlug ChannelPlugs[NumChannels][3];
+	MPlug RotateOrderPlug;
+};
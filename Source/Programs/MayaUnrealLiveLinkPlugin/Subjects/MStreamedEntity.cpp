@@ -21,9 +21,11 @@
 // SOFTWARE.
 
 #include "MStreamedEntity.h"
+#include "MSceneDeformerIndex.h"
 #include "../MayaLiveLinkStreamManager.h"
 #include "../MayaUnrealLiveLinkUtils.h"
 
+#include <algorithm>
 #include <cmath>
 
 THIRD_PARTY_INCLUDES_START
@@ -31,14 +33,16 @@ THIRD_PARTY_INCLUDES_START
 #include <maya/MDistance.h>
 #include <maya/MDGContextGuard.h>
 #include <maya/MFnMatrixData.h>
+#include <maya/MFnIkJoint.h>
 #include <maya/MFnNurbsCurve.h>
+#include <maya/MItDag.h>
 #include <maya/MItCurveCV.h>
 #include <maya/MString.h>
 #include <maya/MStringArray.h>
 #include <maya/MDagPath.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
-#include <maya/MFnMesh.h>
 THIRD_PARTY_INCLUDES_END
 
 const std::array<double, MTime::Unit::kLast> MStreamedEntity::MayaTimeUnitToFPS =
@@ -141,7 +145,8 @@ MStreamedEntity::MKeyFrame* MStreamedEntity::MAnimCurve::FindKeyFrame(double Tim
 }
 
 MStreamedEntity::MStreamedEntity(const MDagPath& DagPath)
-: HIKEffectorsProcessed(false)
+: CallbackRegistrationSeconds(0.0)
+, HIKEffectorsProcessed(false)
 , bTransformCurvesBaked(false)
 , bHasMotionPath(false)
 , bHasConstraint(false)
@@ -513,13 +518,15 @@ void MStreamedEntity::UpdateAnimCurveKeys(MObject& AnimCurveObject,
 	}
 }
 
-void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot)
+void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath)
 {
 	if (!DagPath.isValid())
 	{
 		return;
 	}
 
+	const double RegistrationStartTime = FPlatformTime::Seconds();
+
 	MStatus Status;
 	MObject Node = DagPath.node(&Status);
 	if (!Status)
@@ -528,6 +535,7 @@ void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot
 		return;
 	}
 
+	// The subject is identified by its root, the deletion and renaming of the other nodes don't affect it.
 	// AboutToDelete callback
 	auto AboutToDeleteCallbackId = MNodeMessage::addNodeAboutToDeleteCallback(Node, AboutToDeleteCallback, nullptr, &Status);
 	if (Status)
@@ -554,31 +562,51 @@ void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot
 		return;
 	}
 
-	// AttributeChanged callback
-	auto AttributeChangedCallbackId = MNodeMessage::addAttributeChangedCallback(Node, AttributeChangedCallback, &RootDagPath, &Status);
+	// Gather the nodes of the hierarchy driving the streamed channels first, then install their callbacks in one pass
+	std::vector<MObject> DrivenNodes;
+	MItDag DagIterator(MItDag::kDepthFirst, MFn::kInvalid, &Status);
 	if (Status)
 	{
-		CallbackIds.append(AttributeChangedCallbackId);
+		Status = DagIterator.reset(DagPath, MItDag::kDepthFirst, MFn::kInvalid);
 	}
-	else
+	if (!Status)
 	{
-		MGlobal::displayWarning("Could not attach attribute changed callback for node.");
+		MGlobal::displayWarning("Could not iterate over the hierarchy of " + DagPath.fullPathName());
 		UnregisterNodeCallbacks();
 		return;
 	}
 
-	// Add children
-	MFnDagNode DagNode(Node, &Status);
-	if (Status)
+	for (; !DagIterator.isDone(); DagIterator.next())
 	{
-		if (IsRoot)
+		MDagPath CurrentPath;
+		DagIterator.getPath(CurrentPath);
+
+		// Instanced sub-hierarchies are visited once
+		if (CurrentPath.isInstanced() && CurrentPath.instanceNumber() != 0)
+		{
+			DagIterator.prune();
+			continue;
+		}
+
+		MObject CurrentNode = CurrentPath.node();
+		MFnDagNode DagNode(CurrentNode, &Status);
+		if (!Status)
 		{
-			ProcessBlendShapes(Node);
+			continue;
+		}
 
-			RegisterParentNodeRecursive(Node);
+		// Geometry shapes and intermediate objects don't drive any streamed channel
+		if (DagNode.isIntermediateObject() ||
+			CurrentNode.hasFn(MFn::kMesh) ||
+			CurrentNode.hasFn(MFn::kNurbsSurface) ||
+			CurrentNode.hasFn(MFn::kSubdiv))
+		{
+			continue;
 		}
 
-		if (Node.hasFn(MFn::kIkEffector))
+		DrivenNodes.emplace_back(CurrentNode);
+
+		if (CurrentNode.hasFn(MFn::kIkEffector))
 		{
 			MPlug HandlePathPlugArray = DagNode.findPlug("handlePath", false);
 			if (!HandlePathPlugArray.isNull() && HandlePathPlugArray.isArray())
@@ -592,15 +620,10 @@ void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot
 						HandlePathPlug.connectedTo(SrcPlugArray, false, true);
 						for (unsigned int PlugIdx = 0; PlugIdx < SrcPlugArray.length(); ++PlugIdx)
 						{
-							MPlug& SrcPlug = SrcPlugArray[PlugIdx];
-							MObject SrcObject = SrcPlug.node();
+							MObject SrcObject = SrcPlugArray[PlugIdx].node();
 							if (SrcObject.hasFn(MFn::kIkHandle))
 							{
-								MCallbackId CallbackId = MNodeMessage::addAttributeChangedCallback(SrcObject, AttributeChangedCallback, &RootDagPath, &Status);
-								if (Status)
-								{
-									CallbackIds.append(CallbackId);
-								}
+								DrivenNodes.emplace_back(SrcObject);
 							}
 						}
 					}
@@ -608,33 +631,34 @@ void MStreamedEntity::RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot
 			}
 		}
 
-		if (!HIKEffectorsProcessed && Node.hasFn(MFn::kJoint))
+		if (!HIKEffectorsProcessed && CurrentNode.hasFn(MFn::kJoint))
 		{
-			ProcessHumanIKEffectors(Node);
+			ProcessHumanIKEffectors(CurrentNode);
 		}
 
-		if (Node.hasFn(MFn::kConstraint))
+		if (CurrentNode.hasFn(MFn::kConstraint))
 		{
 			ProcessConstraints(DagNode);
 		}
 
 		ProcessMotionPaths(DagNode);
+	}
 
-		const auto ChildCount = DagNode.childCount();
-		for (unsigned int Child = 0; Child < ChildCount; ++Child)
+	for (const auto& DrivenNode : DrivenNodes)
+	{
+		if (!ObserveNode(DrivenNode))
 		{
-			MObject ChildObject = DagNode.child(Child);
-			if (ChildObject.hasFn(MFn::kDagNode))
-			{
-				MDagPath ChildDagPath;
-				Status = MDagPath::getAPathTo(ChildObject, ChildDagPath);
-				if (Status && ChildDagPath.isValid())
-				{
-					RegisterNodeCallbacks(ChildDagPath, false);
-				}
-			}
+			MGlobal::displayWarning("Could not attach attribute changed callback for node.");
+			UnregisterNodeCallbacks();
+			return;
 		}
 	}
+
+	ProcessBlendShapes(Node);
+
+	RegisterParentNodeRecursive(Node);
+
+	CallbackRegistrationSeconds = FPlatformTime::Seconds() - RegistrationStartTime;
 }
 
 void MStreamedEntity::UnregisterNodeCallbacks()
@@ -644,16 +668,38 @@ void MStreamedEntity::UnregisterNodeCallbacks()
 		MMessage::removeCallbacks(CallbackIds);
 		CallbackIds.clear();
 	}
+	ObservedNodes.clear();
 }
 
 void MStreamedEntity::RegisterParentNode(MObject& ParentNode)
 {
+	ObserveNode(ParentNode);
+}
+
+bool MStreamedEntity::ObserveNode(const MObject& Node)
+{
+	// Each node gets a single attribute changed callback, even when it drives several parts of the subject
+	MObjectHandle Handle(Node);
+	auto Range = ObservedNodes.equal_range(Handle.hashCode());
+	for (auto It = Range.first; It != Range.second; ++It)
+	{
+		if (It->second == Handle)
+		{
+			return true;
+		}
+	}
+
 	MStatus Status;
-	MCallbackId CallbackId = MNodeMessage::addAttributeChangedCallback(ParentNode, AttributeChangedCallback, &RootDagPath, &Status);
-	if (Status)
+	MObject Object(Node);
+	MCallbackId CallbackId = MNodeMessage::addAttributeChangedCallback(Object, AttributeChangedCallback, &RootDagPath, &Status);
+	if (!Status)
 	{
-		CallbackIds.append(CallbackId);
+		return false;
 	}
+
+	CallbackIds.append(CallbackId);
+	ObservedNodes.emplace(Handle.hashCode(), Handle);
+	return true;
 }
 
 void MStreamedEntity::AboutToDeleteCallback(MObject& Node, MDGModifier& Modifier, void* ClientData)
@@ -722,106 +768,30 @@ void MStreamedEntity::OnAttributeChanged(const MObject& Object, const MPlug& Plu
 
 void MStreamedEntity::ProcessBlendShapes(const MObject& SubjectObject)
 {
-	MStatus Status;
-
 	BlendShapeNames.clear();
 
 	MDagPathArray DagPathArray;
 
-	// Iterate through blendshapes
-	MItDependencyNodes BlendShapeIterator(MFn::kBlendShape);
-	while (!BlendShapeIterator.isDone())
+	// Get the blendshapes associated with the subject from the scene deformer index
+	std::vector<MObject> BlendShapeObjects;
+	MSceneDeformerIndex::TheOne().GetBlendShapesForSubject(SubjectObject, BlendShapeObjects);
+	for (auto& BlendShapeObj : BlendShapeObjects)
 	{
-		MFnBlendShapeDeformer BlendShape(BlendShapeIterator.thisNode());
+		MFnBlendShapeDeformer BlendShape(BlendShapeObj);
 
 		MPlug WeightPlug = BlendShape.findPlug("weight", false);
 		if (WeightPlug.isNull() || !WeightPlug.isArray())
 		{
-			BlendShapeIterator.next();
 			continue;
 		}
 
-		// Get the base objects of the current blendshape.
-		// The base objects are the shapes that are to be deformed.
-		MObjectArray BaseObjects;
-		BlendShape.getBaseObjects(BaseObjects);
-		const MString InMeshString("inMesh");
-
-		// Iterate through the base objects to see if they are associated with the subject.
-		for (unsigned int IdxBaseObject = 0; IdxBaseObject < BaseObjects.length(); IdxBaseObject++)
+		// Add a callback on the blendshape node to know when it changes.
+		if (ObserveNode(BlendShapeObj))
 		{
-			auto& BaseObject = BaseObjects[IdxBaseObject];
-			if (!BaseObject.hasFn(MFn::kMesh))
-			{
-				continue;
-			}
+			BlendShapeNames.append(BlendShape.name());
 
-			// Find the "inMesh" plug.
-			MFnMesh Mesh(BaseObject);
-			auto InMeshPlug = Mesh.findPlug(InMeshString, true, &Status);
-			if (!Status)
-			{
-				continue;
-			}
-
-			// Check if a skin cluster is attached to the mesh.
-			MPlugArray PlugArray;
-			InMeshPlug.connectedTo(PlugArray, true, false);
-			for (unsigned int i = 0; i < PlugArray.length(); ++i)
-			{
-				auto PlugNode = PlugArray[i].node();
-				if (PlugNode.hasFn(MFn::kSkinClusterFilter))
-				{
-					MFnSkinCluster SkinCluster(PlugNode);
-					MDagPathArray InfluenceObjectPaths;
-					const unsigned int NumInfluenceObjects = SkinCluster.influenceObjects(InfluenceObjectPaths);
-					for (unsigned int Dag = 0; Dag < NumInfluenceObjects; ++Dag)
-					{
-						// Check if the object is part of the subject hierarchy.
-						MFnDagNode ChildNode(InfluenceObjectPaths[Dag]);
-						if (!ChildNode.isChildOf(SubjectObject))
-						{
-							continue;
-						}
-
-						// Add a callback on the blendshape node to know when it changes.
-						auto BlendShapeObj = BlendShapeIterator.thisNode();
-						auto CallbackId = MNodeMessage::addAttributeChangedCallback(BlendShapeObj,
-																					AttributeChangedCallback,
-																					&RootDagPath,
-																					&Status);
-						if (Status)
-						{
-							BlendShapeNames.append(BlendShape.name());
-
-							CallbackIds.append(CallbackId);
-
-							ProcessBlendShapeControllers(BlendShape, DagPathArray);
-						}
-						break;
-					}
-				}
-				else 
-				{
-					// Add a callback on the blendshape node to know when it changes.
-					auto BlendShapeObj = BlendShapeIterator.thisNode();
-					auto CallbackId = MNodeMessage::addAttributeChangedCallback(BlendShapeObj,
-																				AttributeChangedCallback,
-																				&RootDagPath,
-																				&Status);
-					if (Status)
-					{
-						BlendShapeNames.append(BlendShape.name());
-
-						CallbackIds.append(CallbackId);
-
-						ProcessBlendShapeControllers(BlendShape, DagPathArray);
-					}
-				}
-			}
+			ProcessBlendShapeControllers(BlendShape, DagPathArray);
 		}
-
-		BlendShapeIterator.next();
 	}
 }
 
@@ -844,14 +814,8 @@ bool MStreamedEntity::RegisterController(const MPlug& Plug, MDagPathArray& DagPa
 				TransformNode.getPath(DagPath);
 				if (DagPath.isValid() && MayaUnrealLiveLinkUtils::AddUnique(DagPath, DagPathArray))
 				{
-					auto CallbackId = MNodeMessage::addAttributeChangedCallback(DstPlugObject,
-																				AttributeChangedCallback,
-																				&RootDagPath,
-																				&Status);
-					if (Status)
+					if (ObserveNode(DstPlugObject))
 					{
-						CallbackIds.append(CallbackId);
-
 						DynamicPlugs.append(DstPlug);
 
 						Registered = true;
@@ -901,86 +865,36 @@ void MStreamedEntity::ProcessHumanIKEffectors(const MObject& Node)
 
 	// The connected plugs are on the HIKCharacter node that will be used to
 	// match with the HikIKEffectors
-	MFnDependencyNode HIKCharacterNode(ConnectedPlugs[0].node());
-	HIKCharacterNodeName = HIKCharacterNode.name();
+	HIKCharacterNode = ConnectedPlugs[0].node();
 
 	HIKEffectorsProcessed = true;
 
-	// Look at all the HikIKEffectors in the scene to find the ones affecting the selected subject
-	MItDependencyNodes HikIKEffectorIterator(MFn::kHikIKEffector);
-	while (!HikIKEffectorIterator.isDone())
+	// Look up the HikIKEffectors affecting the selected subject
+	std::vector<MObject> HikIKEffectors;
+	MSceneDeformerIndex::TheOne().GetHikIKEffectors(HIKCharacterNode.object(), HikIKEffectors);
+	for (auto& Object : HikIKEffectors)
 	{
-		MObject Object = HikIKEffectorIterator.thisNode();
-
-		if (IsUsingHikIKEffector(Object))
+		// Add a callback so that we can stream the transforms when an effector is moved
+		if (!ObserveNode(Object))
 		{
-			// Add a callback so that we can stream the transforms when an effector is moved
-			MCallbackId CallbackId = MNodeMessage::addAttributeChangedCallback(Object,
-																			   AttributeChangedCallback,
-																			   &RootDagPath,
-																			   &Status);
-			if (Status)
-			{
-				CallbackIds.append(CallbackId);
-			}
-			else
-			{
-				MGlobal::displayWarning("Could not attach attribute changed callback for node.");
-				UnregisterNodeCallbacks();
-				return;
-			}
+			MGlobal::displayWarning("Could not attach attribute changed callback for node.");
+			UnregisterNodeCallbacks();
+			return;
 		}
-
-		HikIKEffectorIterator.next();
 	}
 }
 
 bool MStreamedEntity::IsUsingHikIKEffector(const MObject& HikIKEffectorObject)
 {
-	MStatus Status;
-	MFnTransform HikIKEffector(HikIKEffectorObject, &Status);
-	if (!Status)
-	{
-		return false;
-	}
-
-	// Get the control set plug which will refer to the control rig
-	auto ControlSetPlug = HikIKEffector.findPlug("ControlSet", true, &Status);
-	if (!Status)
-	{
-		return false;
-	}
-
-	// Get the source plugs connected to the control set
-	MPlugArray ControlSetPlugSrcs;
-	ControlSetPlug.connectedTo(ControlSetPlugSrcs, false, true);
-	if (ControlSetPlugSrcs.length() == 0)
-	{
-		return false;
-	}
-
-	// Get the control rig node and find the InputCharacterDefinition plug which will refer a HIKCharacter node
-	MFnDependencyNode ControlRigNode(ControlSetPlugSrcs[0].node());
-	auto ICDPlug = ControlRigNode.findPlug("InputCharacterDefinition", true, &Status);
-	if (!Status)
+	// Try to match the InputCharacterDefinition from the effector to the one of this subject
+	if (!HIKCharacterNode.isValid())
 	{
 		return false;
 	}
 
-	MPlugArray ICDPlugs;
-	ICDPlug.connectedTo(ICDPlugs, true, false);
-	for (unsigned int i = 0; i < ICDPlugs.length(); ++i)
-	{
-		MFnDependencyNode ICD(ICDPlugs[i].node());
-
-		// Try to match the InputCharacterDefinition from the effector to the one of this subject
-		if (ICD.name() == HIKCharacterNodeName)
-		{
-			return true;
-		}
-	}
-
-	return false;
+	std::vector<MObject> Characters;
+	MSceneDeformerIndex::GetHikIKEffectorCharacters(HikIKEffectorObject, Characters);
+	return std::find(Characters.begin(), Characters.end(), HIKCharacterNode.object()) != Characters.end();
 }
 
 void MStreamedEntity::ProcessConstraints(const MFnDagNode& DagNode)
@@ -1031,10 +945,8 @@ void MStreamedEntity::ProcessConstraints(const MFnDagNode& DagNode)
 				if (DagPathFound == DagPathArray.end())
 				{
 					DagPathArray.append(TransformDagPath);
-					auto CallbackId = MNodeMessage::addAttributeChangedCallback(NodeObject, AttributeChangedCallback, &RootDagPath, &Status);
-					if (Status)
+					if (ObserveNode(NodeObject))
 					{
-						CallbackIds.append(CallbackId);
 						bHasConstraint = true;
 					}
 				}
@@ -1045,7 +957,6 @@ void MStreamedEntity::ProcessConstraints(const MFnDagNode& DagNode)
 
 void MStreamedEntity::ProcessMotionPaths(const MFnDagNode& DagNode)
 {
-	MStatus Status;
 	MObjectArray MotionPaths;
 	MPlugArray Connections;
 	DagNode.getConnections(Connections);
@@ -1082,40 +993,20 @@ void MStreamedEntity::ProcessMotionPaths(const MFnDagNode& DagNode)
 							if (GeometryPathNode.hasFn(MFn::kNurbsCurve))
 							{
 								MFnNurbsCurve Curve(GeometryPathNode);
-								auto CallbackId = MNodeMessage::addAttributeChangedCallback(GeometryPathNode,
-																							AttributeChangedCallback,
-																							&RootDagPath,
-																							&Status);
-								if (Status)
+								if (ObserveNode(GeometryPathNode))
 								{
-									CallbackIds.append(CallbackId);
 									bHasMotionPath = true;
 								}
 
 								if (Curve.parentCount() > 0)
 								{
-									MObject ParentObject = Curve.parent(0);
-									CallbackId = MNodeMessage::addAttributeChangedCallback(ParentObject,
-																						   AttributeChangedCallback,
-																						   &RootDagPath,
-																						   &Status);
-									if (Status)
-									{
-										CallbackIds.append(CallbackId);
-									}
+									ObserveNode(Curve.parent(0));
 								}
 							}
 						}
 					}
 
-					auto CallbackId = MNodeMessage::addAttributeChangedCallback(PlugObject,
-																				AttributeChangedCallback,
-																				&RootDagPath,
-																				&Status);
-					if (Status)
-					{
-						CallbackIds.append(CallbackId);
-					}
+					ObserveNode(PlugObject);
 
 					MotionPaths.append(PlugObject);
 				}
@@ -1292,7 +1183,7 @@ void MStreamedEntity::RebuildLevelSequenceSubject(const MString& SubjectName,
 {
 	FMayaLiveLinkLevelSequenceStaticData& StaticData = MayaLiveLinkStreamManager::TheOne().InitializeAndGetStaticDataFromUnreal<FMayaLiveLinkLevelSequenceStaticData>();
 	InitializeStaticData(StaticData, SavedAssetName, SavedAssetPath, UnrealAssetName, UnrealAssetPath);
-	MayaLiveLinkStreamManager::TheOne().RebuildLevelSequenceSubject(SubjectName);
+	MayaLiveLinkStreamManager::TheOne().RebuildLevelSequenceSubject(FName(SubjectName.asChar()));
 
 	if (ForceRelink)
 	{
@@ -1314,7 +1205,8 @@ bool MStreamedEntity::ShouldBakeTransform() const
 
 void MStreamedEntity::RegisterParentNodeRecursive(MObject& Node)
 {
-	if (Node.hasFn(MFn::kDagNode))
+	// The world node doesn't have any attribute driving the subject
+	if (Node.hasFn(MFn::kDagNode) && !Node.hasFn(MFn::kWorld))
 	{
 		MFnDagNode DagNode(Node);
 		if (DagNode.parentCount() != 0)
@@ -26,6 +26,7 @@
 
 #include <array>
 #include <map>
+#include <unordered_map>
 
 THIRD_PARTY_INCLUDES_START
 #include <maya/MFnAnimCurve.h>
@@ -34,6 +35,7 @@ THIRD_PARTY_INCLUDES_START
 #include <maya/MStringArray.h>
 #include <maya/MDagPath.h>
 #include <maya/MObject.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MCallbackIdArray.h>
 #include <maya/MDGModifier.h>
@@ -89,6 +91,10 @@ public:
 
 	void RegisterParentNode(MObject& ParentNode);
 
+	//! Number of Maya callbacks installed for this subject and the time it took to install them
+	unsigned int GetNumCallbacks() const { return CallbackIds.length(); }
+	double GetCallbackRegistrationSeconds() const { return CallbackRegistrationSeconds; }
+
 public:
 	struct MKeyFrame
 	{
@@ -155,8 +161,9 @@ protected:
 	virtual void OnAttributeChanged(const MObject& Object, const MPlug& Plug, const MPlug& OtherPlug);
 
 private:
-	void RegisterNodeCallbacks(const MDagPath& DagPath, bool IsRoot = true);
+	void RegisterNodeCallbacks(const MDagPath& DagPath);
 	void UnregisterNodeCallbacks();
+	bool ObserveNode(const MObject& Node);
 	void RegisterParentNodeRecursive(MObject& Node);
 
 	// Callback functions
@@ -179,8 +186,10 @@ private:
 
 private:
 	MCallbackIdArray CallbackIds;
+	std::unordered_multimap<unsigned int, MObjectHandle> ObservedNodes;
+	double CallbackRegistrationSeconds;
 	bool HIKEffectorsProcessed;
-	MString HIKCharacterNodeName;
+	MObjectHandle HIKCharacterNode;
 	bool bTransformCurvesBaked;
 	MStringArray BlendShapeNames;
 	bool bHasMotionPath;
@@ -24,11 +24,16 @@
 
 #include "MessageEndpoint.h"
 #include "MessageEndpointBuilder.h"
+#include "Modules/ModuleManager.h"
 #include "MayaLiveLinkMessageInterceptor.h"
 #include "MayaLiveLinkMessages.h"
 
 FMessageBusLiveLinkProducer::FMessageBusLiveLinkProducer(const FString& ProviderName)
 {
+	// Not loaded when initializing Unreal with the minimal profile for another source
+	FModuleManager::Get().LoadModule(TEXT("UdpMessaging"));
+	FModuleManager::Get().LoadModule(TEXT("LiveLinkMessageBusFramework"));
+
 	FMessageEndpointBuilder EndpointBuilder(*ProviderName);
 	EndpointBuilder
 		.Handling<FLiveLinkConnectMessage>(this, &FMessageBusLiveLinkProducer::HandleConnectMessage)
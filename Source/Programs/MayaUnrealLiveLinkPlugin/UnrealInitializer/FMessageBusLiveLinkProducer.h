@@ -79,6 +79,12 @@ public:
 		return LiveLinkProvider->HasConnection();
 	}
 
+	/** The message bus provider keeps the static data of each subject and sends it to every new connection. */
+	virtual bool ReplaysStaticDataOnConnect() const override
+	{
+		return true;
+	}
+
 	/** Function for managing connection status changed delegate. */
 	virtual FDelegateHandle RegisterConnStatusChangedHandle(const FMayaLiveLinkProviderConnectionStatusChanged::FDelegate& ConnStatusChanged) override
 	{
@@ -24,8 +24,11 @@
 
 #include "FMessageBusLiveLinkProducer.h"
 #include "JSONLiveLinkProducer.h"
+#include "MayaLiveLinkInterface.h"
+#include "ProfilingLiveLinkProducer.h"
 
 #include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Serialization/MemoryWriter.h"
 
 #include "Roles/LiveLinkAnimationRole.h"
 #include "Roles/LiveLinkAnimationTypes.h"
@@ -98,6 +101,7 @@ template FLiveLinkCameraFrameData&    FUnrealStreamManager::InitializeAndGetFram
 template FLiveLinkAnimationFrameData& FUnrealStreamManager::InitializeAndGetFrameData();
 template FLiveLinkTransformFrameData& FUnrealStreamManager::InitializeAndGetFrameData();
 template FMayaLiveLinkAnimSequenceFrameData& FUnrealStreamManager::InitializeAndGetFrameData();
+template FMayaLiveLinkAnimSequenceTrackFrameData& FUnrealStreamManager::InitializeAndGetFrameData();
 template FMayaLiveLinkLevelSequenceFrameData& FUnrealStreamManager::InitializeAndGetFrameData();
 
 //======================================================================
@@ -105,7 +109,11 @@ template FMayaLiveLinkLevelSequenceFrameData& FUnrealStreamManager::InitializeAn
 /*!	\brief	Private default constructor.
 */
 FUnrealStreamManager::FUnrealStreamManager()
-: bUpdateWhenDisconnected(false)
+: JSONEndpoint(FIPv4Address(127, 0, 0, 1), 54321)
+, bMessageBusDestination(false)
+, bUpdateWhenDisconnected(false)
+, bAnimSequenceTrackLayout(false)
+, FrameHeartbeatSeconds(1.0)
 {
 }
 
@@ -115,6 +123,7 @@ FUnrealStreamManager::FUnrealStreamManager()
 */
 FUnrealStreamManager::~FUnrealStreamManager()
 {
+	AttachedProviders.Reset();
 	LiveLinkProvider.Reset();
 }
 
@@ -151,32 +160,446 @@ bool	FUnrealStreamManager::SetLiveLinkProvider(LiveLinkSource Producer)
 	{
 		LiveLinkProvider = TSharedPtr<FMessageBusLiveLinkProducer>(new FMessageBusLiveLinkProducer(TEXT("Maya Live Link MessageBus")));
 		FPlatformMisc::LowLevelOutputDebugString(TEXT("Messagebus live link producer created\n"));
+		ApplyLiveLinkDestinations();
 		return true;
 	}
 	else if (LiveLinkSource::JSON == Producer)
 	{
 		auto JSONProvider = TSharedPtr<FJSONLiveLinkProducer>(new FJSONLiveLinkProducer(TEXT("Maya Live Link JSON")));
-		JSONProvider->Connect(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), 54321));
+		JSONProvider->Connect(JSONEndpoint);
 		LiveLinkProvider = JSONProvider;
 		FPlatformMisc::LowLevelOutputDebugString(TEXT("JSON live link producer created\n"));
+		ApplyLiveLinkDestinations();
 		return true;
 	}
+	else if (LiveLinkSource::Profiling == Producer)
+	{
+		LiveLinkProvider = TSharedPtr<FProfilingLiveLinkProducer>(new FProfilingLiveLinkProducer(TEXT("Maya Live Link Profiling")));
+		FPlatformMisc::LowLevelOutputDebugString(TEXT("Profiling live link producer created\n"));
+		ApplyLiveLinkDestinations();
+		return true;
+	}
+	else
+	{
+		FPlatformMisc::LowLevelOutputDebugString(TEXT("Invalid LiveLink source\n"));
+		return false;
+	}
+}
+
+//======================================================================
+/*!	\brief	Set the endpoint used by the JSON live link provider.
+
+When the JSON provider is the current provider, it sends to the new endpoint right away
+instead of the previous one. Otherwise the endpoint is used the next time it's selected.
+
+\param[in] Endpoint Address and port of the JSON receiver.
+
+\return	True when the current provider now sends to a different receiver.
+*/
+bool FUnrealStreamManager::SetJSONEndpoint(const FIPv4Endpoint& Endpoint)
+{
+	if (JSONEndpoint == Endpoint)
+	{
+		return false;
+	}
+
+	JSONEndpoint = Endpoint;
+	if (!LiveLinkProvider || LiveLinkProvider->GetSourceType() != LiveLinkSource::JSON)
+	{
+		return false;
+	}
+
+	ApplyLiveLinkDestinations();
+	return true;
+}
+
+//======================================================================
+/*!	\brief	Add a destination that receives the same data as the current live link provider.
+
+Subjects are evaluated once per tick and the resulting data is dispatched to every destination.
+JSON destinations share a single producer, so the data is also encoded only once for all of them.
+
+\param[in] Source   Live link source of the destination.
+\param[in] Endpoint Address and port of the receiver, only used by JSON destinations.
+
+\return	True when the destination was added.
+*/
+bool FUnrealStreamManager::AddLiveLinkDestination(LiveLinkSource Source, const FString& Endpoint)
+{
+	if (LiveLinkSource::MessageBus == Source)
+	{
+		bMessageBusDestination = true;
+	}
+	else if (LiveLinkSource::JSON == Source)
+	{
+		FIPv4Endpoint DestinationEndpoint;
+		if (!FIPv4Endpoint::Parse(Endpoint, DestinationEndpoint))
+		{
+			FPlatformMisc::LowLevelOutputDebugString(TEXT("Invalid JSON destination endpoint\n"));
+			return false;
+		}
+		JSONDestinations.AddUnique(DestinationEndpoint);
+	}
 	else
 	{
 		FPlatformMisc::LowLevelOutputDebugString(TEXT("Invalid LiveLink source\n"));
 		return false;
 	}
+
+	ApplyLiveLinkDestinations();
+	return true;
+}
+
+//======================================================================
+/*!	\brief	Remove a destination previously added with AddLiveLinkDestination.
+
+\param[in] Source   Live link source of the destination.
+\param[in] Endpoint Address and port of the receiver, only used by JSON destinations.
+
+\return	True when the destination was removed.
+*/
+bool FUnrealStreamManager::RemoveLiveLinkDestination(LiveLinkSource Source, const FString& Endpoint)
+{
+	bool bRemoved = false;
+	if (LiveLinkSource::MessageBus == Source)
+	{
+		bRemoved = bMessageBusDestination;
+		bMessageBusDestination = false;
+	}
+	else if (LiveLinkSource::JSON == Source)
+	{
+		FIPv4Endpoint DestinationEndpoint;
+		if (FIPv4Endpoint::Parse(Endpoint, DestinationEndpoint))
+		{
+			bRemoved = JSONDestinations.Remove(DestinationEndpoint) > 0;
+		}
+	}
+
+	if (bRemoved)
+	{
+		ApplyLiveLinkDestinations();
+	}
+	return bRemoved;
+}
+
+//======================================================================
+/*!	\brief	Remove every additional destination and release their producers.
+*/
+void FUnrealStreamManager::RemoveAllLiveLinkDestinations()
+{
+	JSONDestinations.Reset();
+	bMessageBusDestination = false;
+	ApplyLiveLinkDestinations();
+}
+
+//======================================================================
+/*!	\brief	Release every producer.
+
+	The producers must be released before the engine exits since their message
+	endpoints and sockets rely on the engine modules.
+*/
+void FUnrealStreamManager::ReleaseLiveLinkProviders()
+{
+	AttachedProviders.Reset();
+	LiveLinkProvider.Reset();
+	ResetSentDataHashes();
+}
+
+//======================================================================
+/*!	\brief	Get the list of additional destinations.
+
+\param[out] Destinations Destinations formatted as "MessageBus" or "JSON:<address>:<port>".
+*/
+void FUnrealStreamManager::GetLiveLinkDestinations(TArray<FString>& Destinations) const
+{
+	Destinations.Reset();
+	if (bMessageBusDestination)
+	{
+		Destinations.Add(LiveLinkSourceNames[LiveLinkSource::MessageBus]);
+	}
+	for (const FIPv4Endpoint& Destination : JSONDestinations)
+	{
+		Destinations.Add(FString(LiveLinkSourceNames[LiveLinkSource::JSON]) + TEXT(":") + Destination.ToString());
+	}
+}
+
+//======================================================================
+/*!	\brief	Create or update the producers needed to reach the additional destinations.
+
+JSON destinations are added to the current provider when it is a JSON provider, otherwise
+a single attached JSON producer sends to all of them. A MessageBus destination is only
+needed when the current provider isn't already MessageBus.
+*/
+void FUnrealStreamManager::ApplyLiveLinkDestinations()
+{
+	// New receivers need the static and frame data of every subject
+	ResetSentDataHashes();
+
+	const bool bIsJSONProvider = LiveLinkProvider && LiveLinkProvider->GetSourceType() == LiveLinkSource::JSON;
+	const bool bIsMessageBusProvider = LiveLinkProvider && LiveLinkProvider->GetSourceType() == LiveLinkSource::MessageBus;
+
+	TSharedPtr<ILiveLinkProducer> MessageBusProvider;
+	TSharedPtr<FJSONLiveLinkProducer> JSONProvider;
+	for (auto& AttachedProvider : AttachedProviders)
+	{
+		if (AttachedProvider->GetSourceType() == LiveLinkSource::MessageBus)
+		{
+			MessageBusProvider = AttachedProvider;
+		}
+		else if (AttachedProvider->GetSourceType() == LiveLinkSource::JSON)
+		{
+			JSONProvider = StaticCastSharedPtr<FJSONLiveLinkProducer>(AttachedProvider);
+		}
+	}
+	AttachedProviders.Reset();
+
+	if (bMessageBusDestination && !bIsMessageBusProvider)
+	{
+		if (!MessageBusProvider)
+		{
+			MessageBusProvider = MakeShared<FMessageBusLiveLinkProducer>(TEXT("Maya Live Link MessageBus"));
+		}
+		AttachedProviders.Add(MessageBusProvider);
+	}
+
+	if (bIsJSONProvider)
+	{
+		// Keep the provider's own endpoint, which may have changed, and sync the other ones with the destination list
+		auto Provider = StaticCastSharedPtr<FJSONLiveLinkProducer>(LiveLinkProvider);
+		TArray<FIPv4Endpoint> CurrentDestinations = Provider->GetDestinations();
+		for (const FIPv4Endpoint& Destination : CurrentDestinations)
+		{
+			if (Destination != JSONEndpoint && !JSONDestinations.Contains(Destination))
+			{
+				Provider->RemoveDestination(Destination);
+			}
+		}
+		Provider->AddDestination(JSONEndpoint);
+		for (const FIPv4Endpoint& Destination : JSONDestinations)
+		{
+			Provider->AddDestination(Destination);
+		}
+	}
+	else if (JSONDestinations.Num() > 0)
+	{
+		if (!JSONProvider || !JSONProvider->HasConnection())
+		{
+			JSONProvider = MakeShared<FJSONLiveLinkProducer>(TEXT("Maya Live Link JSON"));
+			JSONProvider->Connect(JSONDestinations[0]);
+		}
+
+		TArray<FIPv4Endpoint> CurrentDestinations = JSONProvider->GetDestinations();
+		for (const FIPv4Endpoint& Destination : CurrentDestinations)
+		{
+			if (!JSONDestinations.Contains(Destination))
+			{
+				JSONProvider->RemoveDestination(Destination);
+			}
+		}
+		for (const FIPv4Endpoint& Destination : JSONDestinations)
+		{
+			JSONProvider->AddDestination(Destination);
+		}
+		AttachedProviders.Add(JSONProvider);
+	}
+}
+
+//======================================================================
+/*!	\brief	Compute the content hash of the working static data.
+
+Anim and level sequence static data have no hash, they are always sent since they trigger
+the creation of assets in the editor.
+
+\param[in]  Role Live Link role of the subject.
+\param[out] Hash Hash of the role and the working static data.
+
+\return	True when the static data can be skipped if the same hash was already sent.
+*/
+bool FUnrealStreamManager::GetStaticDataHash(TSubclassOf<ULiveLinkRole> Role, uint32& Hash) const
+{
+	if (!Role ||
+		Role->IsChildOf(UMayaLiveLinkAnimSequenceRole::StaticClass()) ||
+		Role->IsChildOf(UMayaLiveLinkLevelSequenceRole::StaticClass()))
+	{
+		return false;
+	}
+
+	Hash = HashCombine(GetTypeHash(Role->GetFName()),
+					   FMayaLiveLinkInterfaceModule::GetStaticDataHash(WorkingStaticData.GetStruct(),
+																	   WorkingStaticData.GetBaseData()));
+	return true;
+}
+
+//======================================================================
+/*!	\brief	Send the working static data to the current provider and every attached provider.
+
+The working data is copied for the attached providers and moved to the current provider last.
+Static data identical to the last one sent for the subject is skipped. The hash is only
+recorded once every provider accepted the data, so that a failed send is retried.
+
+\param[in] SubjectName Name of the subject to be updated.
+\param[in] Role        Live Link role of the subject.
+*/
+void FUnrealStreamManager::UpdateSubjectStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role)
+{
+	uint32 Hash = 0;
+	const bool bHasHash = GetStaticDataHash(Role, Hash);
+	if (bHasHash)
+	{
+		const uint32* SentHash = StaticDataHashes.Find(SubjectName);
+		if (SentHash && *SentHash == Hash)
+		{
+			return;
+		}
+	}
+
+	// The editor drops the frames of a subject when its static data changes
+	SentFrameData.Remove(SubjectName);
+
+	bool bSent = LiveLinkProvider.IsValid();
+	for (auto& AttachedProvider : AttachedProviders)
+	{
+		if (AttachedProvider->HasConnection())
+		{
+			FLiveLinkStaticDataStruct StaticData;
+			StaticData.InitializeWith(WorkingStaticData);
+			bSent &= AttachedProvider->UpdateSubjectStaticData(SubjectName, Role, MoveTemp(StaticData));
+		}
+	}
+
+	if (LiveLinkProvider)
+	{
+		bSent &= LiveLinkProvider->UpdateSubjectStaticData(SubjectName, Role, MoveTemp(WorkingStaticData));
+	}
+
+	if (bHasHash && bSent)
+	{
+		StaticDataHashes.Add(SubjectName, Hash);
+	}
+	else
+	{
+		StaticDataHashes.Remove(SubjectName);
+	}
+}
+
+//======================================================================
+/*!	\brief	Compute the content hash of the working frame data, leaving out its times.
+
+Anim and level sequence frame data have no hash, they are always sent since they are baked
+into assets. No hash is computed either when the frame suppression is disabled.
+
+\param[in]  Role Live Link role of the subject.
+\param[out] Hash Hash of the role and the working frame data.
+
+\return	True when the frame data can be skipped if the same hash was recently sent.
+*/
+bool FUnrealStreamManager::GetFrameDataHash(TSubclassOf<ULiveLinkRole> Role, uint32& Hash)
+{
+	FLiveLinkBaseFrameData* FrameData = WorkingFrameData.GetBaseData();
+	if (FrameHeartbeatSeconds <= 0.0 || !FrameData || !Role ||
+		Role->IsChildOf(UMayaLiveLinkAnimSequenceRole::StaticClass()) ||
+		Role->IsChildOf(UMayaLiveLinkLevelSequenceRole::StaticClass()))
+	{
+		return false;
+	}
+
+	// The times change on every frame even if the subject doesn't move
+	const FLiveLinkWorldTime WorldTime = FrameData->WorldTime;
+	const FQualifiedFrameTime SceneTime = FrameData->MetaData.SceneTime;
+	FrameData->WorldTime = FLiveLinkWorldTime(0.0, 0.0);
+	FrameData->MetaData.SceneTime = FQualifiedFrameTime();
+
+	FrameDataBytes.Reset();
+	FMemoryWriter Writer(FrameDataBytes);
+	WorkingFrameData.GetStruct()->SerializeBin(Writer, FrameData);
+
+	FrameData->WorldTime = WorldTime;
+	FrameData->MetaData.SceneTime = SceneTime;
+
+	Hash = FCrc::MemCrc32(FrameDataBytes.GetData(), FrameDataBytes.Num(), GetTypeHash(Role->GetFName()));
+	return true;
+}
+
+//======================================================================
+/*!	\brief	Send the working frame data to the current provider and every attached provider.
+
+Frames identical to the last one sent for the subject are skipped until the heartbeat is due,
+so that the subject doesn't time out in the editor. The hash is only recorded once every
+provider accepted the frame, so that a failed send isn't mistaken for an unchanged frame.
+
+\param[in] SubjectName Name of the subject to be updated.
+\param[in] Role        Live Link role of the subject.
+*/
+void FUnrealStreamManager::UpdateSubjectFrameData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role)
+{
+	uint32 Hash = 0;
+	const bool bHasHash = GetFrameDataHash(Role, Hash);
+	const double Now = FPlatformTime::Seconds();
+	if (bHasHash)
+	{
+		const FSentFrameData* Sent = SentFrameData.Find(SubjectName);
+		if (Sent && Sent->Hash == Hash && Now - Sent->SendTime < FrameHeartbeatSeconds)
+		{
+			return;
+		}
+	}
+
+	bool bSent = LiveLinkProvider.IsValid();
+	for (auto& AttachedProvider : AttachedProviders)
+	{
+		if (AttachedProvider->HasConnection())
+		{
+			FLiveLinkFrameDataStruct FrameData;
+			FrameData.InitializeWith(WorkingFrameData);
+			bSent &= AttachedProvider->UpdateSubjectFrameData(SubjectName, Role, MoveTemp(FrameData));
+		}
+	}
+
+	if (LiveLinkProvider)
+	{
+		bSent &= LiveLinkProvider->UpdateSubjectFrameData(SubjectName, Role, MoveTemp(WorkingFrameData));
+	}
+
+	if (bHasHash && bSent)
+	{
+		SentFrameData.Add(SubjectName, { Hash, Now });
+	}
+	else
+	{
+		SentFrameData.Remove(SubjectName);
+	}
+}
+
+//======================================================================
+/*!	\brief	Remove a subject from the current provider and every attached provider.
+
+\param[in] SubjectName Name of the subject to be removed.
+*/
+void FUnrealStreamManager::RemoveSubject(const FName& SubjectName)
+{
+	StaticDataHashes.Remove(SubjectName);
+	SentFrameData.Remove(SubjectName);
+
+	for (auto& AttachedProvider : AttachedProviders)
+	{
+		AttachedProvider->RemoveSubject(SubjectName);
+	}
+
+	if (LiveLinkProvider)
+	{
+		LiveLinkProvider->RemoveSubject(SubjectName);
+	}
 }
 
 //======================================================================
 /*!	\brief	Update the "Prop Subject" static data.
 
 \param[in] SubjectName Name of the subject to be updated.
-\param[in] StreamMode  Stream mode for the subject.
+\param[in] StreamRole  Live Link role of the subject.
 
 \return	True when subject's data was updated successfully.
 */
-bool FUnrealStreamManager::RebuildPropSubjectData(const FName& SubjectName, const FString& StreamMode)
+bool FUnrealStreamManager::RebuildPropSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
@@ -184,22 +607,22 @@ bool FUnrealStreamManager::RebuildPropSubjectData(const FName& SubjectName, cons
 	}
 
 	bool ValidSubject = false;
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
 		auto& TransformData = *WorkingStaticData.Cast<FLiveLinkTransformStaticData>();
 		TransformData.bIsScaleSupported = true;
 
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
 		auto& AnimationData = *WorkingStaticData.Cast<FLiveLinkSkeletonStaticData>();
 
 		AnimationData.BoneNames.Add(FName("root"));
 		AnimationData.BoneParents.Add(-1);
 
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 		ValidSubject = true;
 	}
 
@@ -210,22 +633,22 @@ bool FUnrealStreamManager::RebuildPropSubjectData(const FName& SubjectName, cons
 /*!	\brief	Update the "Prop Subject" frame(Stream or animated i.e. data that changes per frame) data.
 
 \param[in] SubjectName  Name of the subject to be updated.
-\param[in] StreamMode   Stream mode for the subject.
+\param[in] StreamRole   Live Link role of the subject.
 */
-void FUnrealStreamManager::OnStreamPropSubject(const FName& SubjectName, const FString& StreamMode)
+void FUnrealStreamManager::OnStreamPropSubject(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
 		return;
 	}
 
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass());
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 	}
 }
 
@@ -233,11 +656,11 @@ void FUnrealStreamManager::OnStreamPropSubject(const FName& SubjectName, const F
 /*!	\brief	Update the "Light Subject" static data.
 
 \param[in] SubjectName Name of the subject to be updated.
-\param[in] StreamMode  Stream mode for the subject.
+\param[in] StreamRole  Live Link role of the subject.
 
 \return	True when subject's data was updated successfully.
 */
-bool FUnrealStreamManager::RebuildLightSubjectData(const FName& SubjectName, const FString& StreamMode)
+bool FUnrealStreamManager::RebuildLightSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
@@ -245,26 +668,26 @@ bool FUnrealStreamManager::RebuildLightSubjectData(const FName& SubjectName, con
 	}
 
 	bool ValidSubject = false;
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
 		auto& AnimationData = *WorkingStaticData.Cast<FLiveLinkSkeletonStaticData>();
 		AnimationData.BoneNames.Add(FName("root"));
 		AnimationData.BoneParents.Add(-1);
 
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "Light")
+	else if (StreamRole == EStreamRole::Light)
 	{
 		auto& LightData = *WorkingStaticData.Cast<FLiveLinkLightStaticData>();
 		LightData.bIsIntensitySupported = true;
 		LightData.bIsLightColorSupported = true;
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkLightRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkLightRole::StaticClass());
 		ValidSubject = true;
 	}
 	return ValidSubject;
@@ -274,26 +697,26 @@ bool FUnrealStreamManager::RebuildLightSubjectData(const FName& SubjectName, con
 /*!	\brief	Update the "Light Subject" frame(Stream or animated i.e. data that changes per frame) data.
 
 \param[in] SubjectName  Name of the subject to be updated.
-\param[in] StreamMode   Stream mode for the subject.
+\param[in] StreamRole   Live Link role of the subject.
 */
-void FUnrealStreamManager::OnStreamLightSubject(const FName& SubjectName, const FString& StreamMode)
+void FUnrealStreamManager::OnStreamLightSubject(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
 		return;
 	}
 
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass());
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 	}
-	else if (StreamMode == "Light")
+	else if (StreamRole == EStreamRole::Light)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkLightRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkLightRole::StaticClass());
 	}
 }
 
@@ -301,11 +724,11 @@ void FUnrealStreamManager::OnStreamLightSubject(const FName& SubjectName, const
 /*!	\brief	Update the "Base Camera Subject" static data.
 
 \param[in] SubjectName Name of the subject to be updated.
-\param[in] StreamMode  Stream mode for the subject.
+\param[in] StreamRole  Live Link role of the subject.
 
 \return	True when subject's data was updated successfully.
 */
-bool FUnrealStreamManager::RebuildBaseCameraSubjectData(const FName& SubjectName, const FString& StreamMode)
+bool FUnrealStreamManager::RebuildBaseCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
@@ -313,23 +736,23 @@ bool FUnrealStreamManager::RebuildBaseCameraSubjectData(const FName& SubjectName
 	}
 
 	bool ValidSubject = false;
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
 		auto& AnimationData = *WorkingStaticData.Cast<FLiveLinkSkeletonStaticData>();
 		AnimationData.BoneNames.Add(FName("root"));
 		AnimationData.BoneParents.Add(-1);
 
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "Camera")
+	else if (StreamRole == EStreamRole::Camera)
 	{
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass());
 		ValidSubject = true;
 	}
 	return ValidSubject;
@@ -339,26 +762,26 @@ bool FUnrealStreamManager::RebuildBaseCameraSubjectData(const FName& SubjectName
 /*!	\brief	Update the "Camera Subject" frame(Stream or animated i.e. data that changes per frame) data.
 
 \param[in] SubjectName     Name of the subject to be updated.
-\param[in] StreamMode      Stream mode for the subject.
+\param[in] StreamRole      Live Link role of the subject.
 */
-void FUnrealStreamManager::StreamCamera(const FName& SubjectName, const FString& StreamMode)
+void FUnrealStreamManager::StreamCamera(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
 		return;
 	}
 
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass());
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 	}
-	else if (StreamMode == "Camera")
+	else if (StreamRole == EStreamRole::Camera)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkCameraRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkCameraRole::StaticClass());
 	}
 }
 
@@ -366,11 +789,11 @@ void FUnrealStreamManager::StreamCamera(const FName& SubjectName, const FString&
 /*!	\brief	Update the "Camera Subject" static data.
 
 \param[in] SubjectName Name of the subject to be updated.
-\param[in] StreamMode  Stream mode for the subject.
+\param[in] StreamRole  Live Link role of the subject.
 
 \return	True when subject's data was updated successfully.
 */
-bool FUnrealStreamManager::RebuildCameraSubjectData(const FName& SubjectName, const FString& StreamMode)
+bool FUnrealStreamManager::RebuildCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
@@ -381,7 +804,7 @@ bool FUnrealStreamManager::RebuildCameraSubjectData(const FName& SubjectName, co
 	CameraData.bIsApertureSupported = true;
 	CameraData.bIsFocusDistanceSupported = true;
 
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass(), MoveTemp(WorkingStaticData));
+	UpdateSubjectStaticData(SubjectName, ULiveLinkCameraRole::StaticClass());
 	return true;
 }
 
@@ -390,11 +813,11 @@ bool FUnrealStreamManager::RebuildCameraSubjectData(const FName& SubjectName, co
 /*!	\brief	Update the "Joint Hierarchy Subject" static data.
 
 \param[in] SubjectName  Name of the subject to be updated.
-\param[in] StreamMode   Stream mode for the subject.
+\param[in] StreamRole   Live Link role of the subject.
 
 \return	True when subject's data was updated successfully.
 */
-bool FUnrealStreamManager::RebuildJointHierarchySubjectData(const FName& SubjectName, const FString& StreamMode)
+bool FUnrealStreamManager::RebuildJointHierarchySubjectData(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
@@ -403,17 +826,17 @@ bool FUnrealStreamManager::RebuildJointHierarchySubjectData(const FName& Subject
 
 	bool ValidSubject = false;
 
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
 		auto& TransformData = *WorkingStaticData.Cast<FLiveLinkTransformStaticData>();
 		TransformData.bIsScaleSupported = true;
 
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkTransformRole::StaticClass());
 		ValidSubject = true;
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
-		LiveLinkProvider->UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingStaticData));
+		UpdateSubjectStaticData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 		ValidSubject = true;
 	}
 
@@ -424,22 +847,22 @@ bool FUnrealStreamManager::RebuildJointHierarchySubjectData(const FName& Subject
 /*!	\brief	Update the "Joint Hierarchy Subject" frame(Stream or animated i.e. data that changes per frame) data.
 
 \param[in] SubjectName     Name of the subject to be updated.
-\param[in] StreamMode      Stream mode for the subject.
+\param[in] StreamRole      Live Link role of the subject.
 */
-void FUnrealStreamManager::OnStreamJointHierarchySubject(const FName& SubjectName, const FString& StreamMode)
+void FUnrealStreamManager::OnStreamJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole)
 {
 	if (!HasConnection())
 	{
 		return;
 	}
 
-	if (StreamMode == "RootOnly")
+	if (StreamRole == EStreamRole::Transform)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkTransformRole::StaticClass());
 	}
-	else if (StreamMode == "FullHierarchy")
+	else if (StreamRole == EStreamRole::Animation)
 	{
-		LiveLinkProvider->UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass(), MoveTemp(WorkingFrameData));
+		UpdateSubjectFrameData(SubjectName, ULiveLinkAnimationRole::StaticClass());
 	}
 }
 
@@ -450,7 +873,7 @@ void FUnrealStreamManager::RebuildAnimSequence(const FName& SubjectName)
 		return;
 	}
 
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, UMayaLiveLinkAnimSequenceRole::StaticClass(), MoveTemp(WorkingStaticData));
+	UpdateSubjectStaticData(SubjectName, bAnimSequenceTrackLayout ? UMayaLiveLinkAnimSequenceTrackRole::StaticClass() : UMayaLiveLinkAnimSequenceRole::StaticClass());
 }
 
 void FUnrealStreamManager::OnStreamAnimSequence(const FName& SubjectName)
@@ -460,7 +883,7 @@ void FUnrealStreamManager::OnStreamAnimSequence(const FName& SubjectName)
 		return;
 	}
 
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, UMayaLiveLinkAnimSequenceRole::StaticClass(), MoveTemp(WorkingFrameData));
+	UpdateSubjectFrameData(SubjectName, bAnimSequenceTrackLayout ? UMayaLiveLinkAnimSequenceTrackRole::StaticClass() : UMayaLiveLinkAnimSequenceRole::StaticClass());
 }
 
 void FUnrealStreamManager::RebuildLevelSequence(const FName& SubjectName)
@@ -470,7 +893,7 @@ void FUnrealStreamManager::RebuildLevelSequence(const FName& SubjectName)
 		return;
 	}
 
-	LiveLinkProvider->UpdateSubjectStaticData(SubjectName, UMayaLiveLinkLevelSequenceRole::StaticClass(), MoveTemp(WorkingStaticData));
+	UpdateSubjectStaticData(SubjectName, UMayaLiveLinkLevelSequenceRole::StaticClass());
 }
 
 void FUnrealStreamManager::OnStreamLevelSequence(const FName& SubjectName)
@@ -480,10 +903,22 @@ void FUnrealStreamManager::OnStreamLevelSequence(const FName& SubjectName)
 		return;
 	}
 
-	LiveLinkProvider->UpdateSubjectFrameData(SubjectName, UMayaLiveLinkLevelSequenceRole::StaticClass(), MoveTemp(WorkingFrameData));
+	UpdateSubjectFrameData(SubjectName, UMayaLiveLinkLevelSequenceRole::StaticClass());
 }
 
 bool FUnrealStreamManager::HasConnection() const
 {
-	return bUpdateWhenDisconnected || (LiveLinkProvider && LiveLinkProvider->HasConnection());
+	if (bUpdateWhenDisconnected || (LiveLinkProvider && LiveLinkProvider->HasConnection()))
+	{
+		return true;
+	}
+
+	for (const auto& AttachedProvider : AttachedProviders)
+	{
+		if (AttachedProvider->HasConnection())
+		{
+			return true;
+		}
+	}
+	return false;
 }
@@ -23,8 +23,19 @@
 #pragma once
 
 #include "ILiveLinkProducer.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "LiveLinkTypes.h"
 
+//! Live Link role a subject is streamed with. The subjects pick it from their stream mode
+//! so that no string has to be compared when streaming.
+enum class EStreamRole : uint8
+{
+	Transform,
+	Animation,
+	Camera,
+	Light,
+};
+
 /*! \class	FUnrealStreamManager
 *		\brief  This class acts as stream manager to interact with UE.
 				This is a singleton and should be accessed by TheOne() function.
@@ -39,6 +50,15 @@ private:
 	//! be either our JSON provider or built in MesssageBus.
 	TSharedPtr<class ILiveLinkProducer> LiveLinkProvider;
 
+	//! Additional producers receiving the same data as LiveLinkProvider, so that several
+	//! receivers can be fed from a single evaluation of the subjects.
+	TArray<TSharedPtr<class ILiveLinkProducer>> AttachedProviders;
+
+	//! Endpoint of the JSON provider and the additional destinations
+	FIPv4Endpoint JSONEndpoint;
+	TArray<FIPv4Endpoint> JSONDestinations;
+	bool bMessageBusDestination;
+
 	//! Member working data structs that can be used by the RebuildSubjectData or
 	//! OnStreamSubject function to send the data to LiveLink providers. We give access
 	//! to these members to subjects in MayaUnrealLiveLink to set the data that needs to
@@ -48,6 +68,26 @@ private:
 
 	bool bUpdateWhenDisconnected;
 
+	//! Send the anim sequence frame data with the track-major layout
+	bool bAnimSequenceTrackLayout;
+
+	//! Content hash of the last static data sent for each subject
+	TMap<FName, uint32> StaticDataHashes;
+
+	//! Content hash of the last frame data sent for a subject and when it was sent
+	struct FSentFrameData
+	{
+		uint32 Hash;
+		double SendTime;
+	};
+	TMap<FName, FSentFrameData> SentFrameData;
+
+	//! Interval in seconds at which an unchanged frame is sent again, 0 to always send
+	double FrameHeartbeatSeconds;
+
+	//! Buffer reused to serialize the frame data when computing its hash
+	TArray<uint8> FrameDataBytes;
+
 public:
 
 	//! Singleton object. Use this function to access it.
@@ -56,9 +96,33 @@ public:
 	TSharedPtr<class ILiveLinkProducer> GetLiveLinkProvider();
 	bool SetLiveLinkProvider(LiveLinkSource Producer);
 
+	bool SetJSONEndpoint(const FIPv4Endpoint& Endpoint);
+	const FIPv4Endpoint& GetJSONEndpoint() const { return JSONEndpoint; }
+
+	//! Additional destinations receiving the same data as the current provider
+	bool AddLiveLinkDestination(LiveLinkSource Source, const FString& Endpoint = FString());
+	bool RemoveLiveLinkDestination(LiveLinkSource Source, const FString& Endpoint = FString());
+	void RemoveAllLiveLinkDestinations();
+	void GetLiveLinkDestinations(TArray<FString>& Destinations) const;
+
+	//! Release the provider and the destination producers
+	void ReleaseLiveLinkProviders();
+
+	void RemoveSubject(const FName& SubjectName);
+
+	//! Forget the static and frame data already sent so that the next rebuild sends everything again
+	void ResetSentDataHashes() { StaticDataHashes.Reset(); SentFrameData.Reset(); }
+
+	//! Unchanged frames are only sent at this interval to keep the subjects alive in the editor
+	void SetFrameHeartbeat(double Seconds) { FrameHeartbeatSeconds = Seconds > 0.0 ? Seconds : 0.0; }
+	double GetFrameHeartbeat() const { return FrameHeartbeatSeconds; }
+
 	void UpdateWhenDisconnected(bool bUpdate) { bUpdateWhenDisconnected = bUpdate; }
 	bool IsUpdateWhenDisconnected() const { return bUpdateWhenDisconnected; }
 
+	void SetAnimSequenceTrackLayout(bool bTrackLayout) { bAnimSequenceTrackLayout = bTrackLayout; }
+	bool IsAnimSequenceTrackLayout() const { return bAnimSequenceTrackLayout; }
+
 private:
 
 	//! Private constructor and destructor for this singleton object
@@ -67,6 +131,12 @@ private:
 
 	bool HasConnection() const;
 
+	void ApplyLiveLinkDestinations();
+	bool GetStaticDataHash(TSubclassOf<ULiveLinkRole> Role, uint32& Hash) const;
+	void UpdateSubjectStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role);
+	bool GetFrameDataHash(TSubclassOf<ULiveLinkRole> Role, uint32& Hash);
+	void UpdateSubjectFrameData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role);
+
 public:
 
 	//! Initialize and get the reference to working static data
@@ -78,23 +148,23 @@ public:
 	T& InitializeAndGetFrameData();
 
 	//! LiveLink functions for Prop subject
-	bool RebuildPropSubjectData(const FName& SubjectName, const FString& StreamMode);
-	void OnStreamPropSubject(const FName& SubjectName, const FString& StreamMode);
+	bool RebuildPropSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamPropSubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! LiveLink functions for Light subject
-	bool RebuildLightSubjectData(const FName& SubjectName, const FString& StreamMode);
-	void OnStreamLightSubject(const FName& SubjectName, const FString& StreamMode);
+	bool RebuildLightSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamLightSubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! LiveLink functions for Base Camera Subject
-	bool RebuildBaseCameraSubjectData(const FName& SubjectName, const FString& StreamMode);
-	void StreamCamera(const FName& SubjectName, const FString& StreamMode);
+	bool RebuildBaseCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void StreamCamera(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! LiveLink functions for Camera Subject
-	bool RebuildCameraSubjectData(const FName& SubjectName, const FString& StreamMode);
+	bool RebuildCameraSubjectData(const FName& SubjectName, EStreamRole StreamRole);
 
 	//! LiveLink functions for Joint Hierarchy Subject
-	bool RebuildJointHierarchySubjectData(const FName& SubjectName, const FString& StreamMode);
-	void OnStreamJointHierarchySubject(const FName& SubjectName, const FString& StreamMode);
+	bool RebuildJointHierarchySubjectData(const FName& SubjectName, EStreamRole StreamRole);
+	void OnStreamJointHierarchySubject(const FName& SubjectName, EStreamRole StreamRole);
 
 	void RebuildAnimSequence(const FName& SubjectName);
 	void OnStreamAnimSequence(const FName& SubjectName);
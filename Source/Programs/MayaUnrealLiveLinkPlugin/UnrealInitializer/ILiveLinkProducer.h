@@ -28,6 +28,7 @@ enum LiveLinkSource
 {
 	MessageBus,
 	JSON,
+	Profiling,
 
 	NumberOfSources
 };
@@ -36,6 +37,7 @@ const char* const LiveLinkSourceNames[LiveLinkSource::NumberOfSources] =
 {
 	"MessageBus",
 	"JSON",
+	"Profiling",
 };
 
 class ILiveLinkProducer
@@ -82,6 +84,9 @@ public:
 	/** Is this provider currently connected to something. */
 	virtual bool HasConnection() const = 0;
 
+	/** Does this provider send the last static data of every subject to new connections by itself. */
+	virtual bool ReplaysStaticDataOnConnect() const { return false; }
+
 	/** Function for managing connection status changed delegate. */
 	virtual FDelegateHandle RegisterConnStatusChangedHandle(const FMayaLiveLinkProviderConnectionStatusChanged::FDelegate& ConnStatusChanged) = 0;
 
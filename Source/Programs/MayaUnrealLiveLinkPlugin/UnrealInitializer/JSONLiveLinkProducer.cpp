@@ -106,20 +106,55 @@ bool FJSONLiveLinkProducer::Connect(const FIPv4Endpoint& InEndpoint)
 		return false;
 	}
 
+	if (!AddDestination(InEndpoint))
+	{
+		CloseConnection();
+		return false;
+	}
+
+	SendSuccess = true;
+	return true;
+}
+
+bool FJSONLiveLinkProducer::AddDestination(const FIPv4Endpoint& InEndpoint)
+{
+	if (Socket == 0)
+	{
+		return false;
+	}
+
+	if (DestinationEndpoints.Contains(InEndpoint))
+	{
+		return true;
+	}
+
+	sockaddr_storage AddrDest = {};
 	FString AddressName = InEndpoint.Address.ToString();
 	FString PortName = FString::FromInt(InEndpoint.Port);
-	Result = ResolveHelper(TCHAR_TO_ANSI(*AddressName), AF_INET, TCHAR_TO_ANSI(*PortName), &AddrDest);
+	int Result = ResolveHelper(TCHAR_TO_ANSI(*AddressName), AF_INET, TCHAR_TO_ANSI(*PortName), &AddrDest);
 	if (Result != 0)
 	{
-		int Lasterror = errno;
-
-		Error.AppendInt(Lasterror);
+		FString Error("Resolve error: ");
+		Error.AppendInt(errno);
 		FPlatformMisc::LowLevelOutputDebugString(*Error);
-		CloseConnection();
 		return false;
 	}
 
-	SendSuccess = true;
+	AddrDests.Add(AddrDest);
+	DestinationEndpoints.Add(InEndpoint);
+	return true;
+}
+
+bool FJSONLiveLinkProducer::RemoveDestination(const FIPv4Endpoint& InEndpoint)
+{
+	const int32 Index = DestinationEndpoints.IndexOfByKey(InEndpoint);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	AddrDests.RemoveAt(Index);
+	DestinationEndpoints.RemoveAt(Index);
 	return true;
 }
 
@@ -134,7 +169,8 @@ void FJSONLiveLinkProducer::CloseConnection()
 		close(Socket);
 #endif
 	}
-	AddrDest = {};
+	AddrDests.Reset();
+	DestinationEndpoints.Reset();
 	Socket = 0;
 	SendSuccess = false;
 	ResetWriter();
@@ -150,6 +186,18 @@ void FJSONLiveLinkProducer::ResetWriter()
 	Writer.Reset(StringBuffer);
 }
 
+bool FJSONLiveLinkProducer::SendToDestinations(const char* Buffer, int32 Size)
+{
+	// The buffer is only encoded once, each receiver gets the same datagram
+	bool bSent = false;
+	for (const sockaddr_storage& AddrDest : AddrDests)
+	{
+		bSent |= sendto(Socket, Buffer, Size, 0, (sockaddr*)&AddrDest, sizeof(AddrDest)) > 0;
+	}
+	SendSuccess = bSent;
+	return SendSuccess;
+}
+
 bool FJSONLiveLinkProducer::SendStringBuffer()
 {
 #ifdef RAPIDJSON_VERSION_STRING
@@ -158,8 +206,7 @@ bool FJSONLiveLinkProducer::SendStringBuffer()
 		const int32 Size = StringBuffer.GetSize();
 		if (Size <= SEND_BUFFER_SIZE)
 		{
-			SendSuccess = sendto(Socket, StringBuffer.GetString(), Size, 0, (sockaddr*)&AddrDest, sizeof(AddrDest)) > 0;
-			return SendSuccess;
+			return SendToDestinations(StringBuffer.GetString(), Size);
 		}
 	}
 	else
@@ -173,8 +220,7 @@ bool FJSONLiveLinkProducer::SendStringBuffer()
 		const int32 Size = StringBuffer.Num();
 		if (Size <= SEND_BUFFER_SIZE)
 		{
-			SendSuccess = sendto(Socket, (const char *)StringBuffer.GetData(), Size, 0, (sockaddr*)&AddrDest, sizeof(AddrDest)) > 0;
-			return SendSuccess;
+			return SendToDestinations((const char *)StringBuffer.GetData(), Size);
 		}
 	}
 	else
@@ -226,7 +272,8 @@ bool FJSONLiveLinkProducer::UpdateSubjectStaticData(const FName& SubjectName, TS
 	{
 		UpdateSubjectStaticData(SubjectName, *StaticData.Cast<FLiveLinkTransformStaticData>());
 	}
-	else if (RoleClass == UMayaLiveLinkAnimSequenceRole::StaticClass())
+	else if (RoleClass == UMayaLiveLinkAnimSequenceRole::StaticClass() ||
+			 RoleClass == UMayaLiveLinkAnimSequenceTrackRole::StaticClass())
 	{
 		UpdateSubjectStaticData(SubjectName, *StaticData.Cast<FMayaLiveLinkAnimSequenceStaticData>());
 	}
@@ -300,6 +347,10 @@ bool FJSONLiveLinkProducer::UpdateSubjectFrameData(const FName& SubjectName, TSu
 	{
 		UpdateSubjectFrameData(SubjectName, *FrameData.Cast<FMayaLiveLinkAnimSequenceFrameData>());
 	}
+	else if (RoleClass == UMayaLiveLinkAnimSequenceTrackRole::StaticClass())
+	{
+		UpdateSubjectFrameData(SubjectName, *FrameData.Cast<FMayaLiveLinkAnimSequenceTrackFrameData>());
+	}
 	else
 	{
 		SupportedRole = false;
@@ -720,6 +771,51 @@ void FJSONLiveLinkProducer::UpdateSubjectFrameData(const FName& SubjectName,
 	SendStringBuffer();
 }
 
+void FJSONLiveLinkProducer::UpdateSubjectFrameData(const FName& SubjectName,
+												   const FMayaLiveLinkAnimSequenceTrackFrameData& FrameData)
+{
+	auto StaticDataPtr = GetLastSubjectStaticData<FMayaLiveLinkAnimSequenceStaticData>(SubjectName);
+	if (StaticDataPtr == nullptr || !FrameData.IsValid())
+	{
+		return;
+	}
+
+	ResetWriter();
+
+	// The JSON format is frame-major, gather the bones of each frame from the tracks
+	int32 FrameIndex = FrameData.StartFrame;
+	for (int32 Index = 0; Index < FrameData.NumFrames; ++Index, ++FrameIndex)
+	{
+		// Frame number
+		if (FrameIndex >= 0 && FrameData.NumBones > 0)
+		{
+			StartWriterFrameData(SubjectName, "Timeline", FrameIndex);
+
+			// Bones
+			Writer.StartObject();
+			Writer.Key("BoneTransforms");
+			{
+				Writer.StartArray();
+				for (int32 i = 0; i < FrameData.NumBones; ++i)
+				{
+					const int32 TrackIndex = FrameData.GetIndex(i, Index);
+					Writer.StartObject();
+					WriteLocation(FrameData.Locations[TrackIndex]);
+					WriteRotation(FrameData.Rotations[TrackIndex]);
+					WriteScale(FrameData.Scales[TrackIndex]);
+					Writer.EndObject();
+				}
+				Writer.EndArray();
+			}
+			Writer.EndObject();
+
+			EndWriterFrameData();
+		}
+	}
+
+	SendStringBuffer();
+}
+
 void FJSONLiveLinkProducer::WriteKey(const char* KeyName,
 									 bool Supported,
 									 bool Value)
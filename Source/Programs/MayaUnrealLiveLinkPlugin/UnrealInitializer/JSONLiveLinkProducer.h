@@ -23,6 +23,7 @@
 #pragma once
 
 #include "ILiveLinkProducer.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
 
 // Network/socket
 #if PLATFORM_WINDOWS
@@ -64,7 +65,6 @@
     #undef JSON__has_include_DEFINED
 #endif
 
-struct FIPv4Endpoint;
 struct FLiveLinkSkeletonStaticData;
 struct FLiveLinkAnimationFrameData;
 struct FLiveLinkCameraStaticData;
@@ -106,6 +106,23 @@ public:
 
 	void CloseConnection();
 
+	/**
+	* Add another receiver to this producer. The data is encoded once and sent to every destination.
+	* @param InEndpoint	The address and port of the receiver.
+	* @return				True if the destination was added or is already part of the destinations.
+	*/
+	bool AddDestination(const FIPv4Endpoint& InEndpoint);
+
+	/**
+	* Stop sending data to a receiver.
+	* @param InEndpoint	The address and port of the receiver.
+	* @return				True if the destination was removed.
+	*/
+	bool RemoveDestination(const FIPv4Endpoint& InEndpoint);
+
+	/** Get the endpoints this producer is sending to. */
+	const TArray<FIPv4Endpoint>& GetDestinations() const { return DestinationEndpoints; }
+
 	/**
 	* Send, to UE4, the static data of a subject.
 	* @param SubjectName	The name of the subject
@@ -154,6 +171,7 @@ private:
 	void ResetWriter();
 
 	bool SendStringBuffer();
+	bool SendToDestinations(const char* Buffer, int32 Size);
 
 	void ClearTrackedSubject(const FName& SubjectName);
 	void SetLastSubjectStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role, FLiveLinkStaticDataStruct&& StaticData);
@@ -172,6 +190,7 @@ private:
 
 	void UpdateSubjectStaticData(const FName& SubjectName, struct FMayaLiveLinkAnimSequenceStaticData& StaticData);
 	void UpdateSubjectFrameData(const FName& SubjectName, const struct FMayaLiveLinkAnimSequenceFrameData& FrameData);
+	void UpdateSubjectFrameData(const FName& SubjectName, const struct FMayaLiveLinkAnimSequenceTrackFrameData& FrameData);
 
 	// JSON Writer helper functions
 	void WriteKey(const char* KeyName, bool Supported, bool Value);
@@ -213,7 +232,9 @@ private:
 #else
 	int Socket;
 #endif
-	sockaddr_storage AddrDest = {};
+	// Resolved addresses of the receivers, parallel to DestinationEndpoints
+	TArray<sockaddr_storage> AddrDests;
+	TArray<FIPv4Endpoint> DestinationEndpoints;
 	bool SendSuccess = true;
 
 #ifdef RAPIDJSON_VERSION_STRING
@@ -43,9 +43,35 @@ FMayaLiveLinkProvider::FMayaLiveLinkProvider(const FString& InProviderName, FMes
 {
 }
 
+bool FMayaLiveLinkProvider::CanQuery() const
+{
+	// Requests are only sent to the connected editors, nothing could answer without a connection
+	return HasConnection();
+}
+
+bool FMayaLiveLinkProvider::WaitForQueryResult(double TimeoutSeconds) const
+{
+	// Stop waiting as soon as the editor shuts down its source
+	const double Start = FPlatformTime::Seconds();
+	while ((FPlatformTime::Seconds() - Start) < TimeoutSeconds && CanQuery())
+	{
+		{
+			FScopeLock Lock(&CriticalSection);
+			if (QueriedResultReady)
+			{
+				return true;
+			}
+		}
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	return QueriedResultReady;
+}
+
 bool FMayaLiveLinkProvider::GetAssetsByClass(const FString& ClassName, bool bSearchSubClasses, TMap<FString, FStringArray>& Assets)
 {
-	if (ClassName.IsEmpty())
+	if (ClassName.IsEmpty() || !CanQuery())
 	{
 		return false;
 	}
@@ -60,11 +86,7 @@ bool FMayaLiveLinkProvider::GetAssetsByClass(const FString& ClassName, bool bSea
 	SendMessage(Message);
 
 	// Wait for the return message or time out if it takes too long
-	double Start = FPlatformTime::Seconds();
-	while ((FPlatformTime::Seconds() - Start) < 5 && !QueriedResultReady)
-	{
-		FPlatformProcess::Sleep(0.1f);
-	}
+	WaitForQueryResult(5.0);
 
 	Assets.Empty();
 	{
@@ -86,7 +108,7 @@ bool FMayaLiveLinkProvider::GetAssetsByParentClass(const FString& ClassName,
 												   FStringArray& Assets,
 												   FStringArray& NativeAssetClasses)
 {
-	if (ClassName.IsEmpty())
+	if (ClassName.IsEmpty() || !CanQuery())
 	{
 		return false;
 	}
@@ -102,11 +124,7 @@ bool FMayaLiveLinkProvider::GetAssetsByParentClass(const FString& ClassName,
 	SendMessage(Message);
 
 	// Wait for the return message or time out if it takes too long
-	double Start = FPlatformTime::Seconds();
-	while ((FPlatformTime::Seconds() - Start) < 10 && !QueriedResultReady)
-	{
-		FPlatformProcess::Sleep(0.1f);
-	}
+	WaitForQueryResult(10.0);
 
 	Assets.Array.Empty();
 	NativeAssetClasses.Array.Empty();
@@ -134,7 +152,7 @@ bool FMayaLiveLinkProvider::GetAssetsByParentClass(const FString& ClassName,
 
 bool FMayaLiveLinkProvider::GetActorsByClass(const FString& ClassName, TMap<FString, FStringArray>& Actors)
 {
-	if (ClassName.IsEmpty())
+	if (ClassName.IsEmpty() || !CanQuery())
 	{
 		return false;
 	}
@@ -148,11 +166,7 @@ bool FMayaLiveLinkProvider::GetActorsByClass(const FString& ClassName, TMap<FStr
 	SendMessage(Message);
 
 	// Wait for the return message or time out if it takes too long
-	double Start = FPlatformTime::Seconds();
-	while ((FPlatformTime::Seconds() - Start) < 5 && !QueriedResultReady)
-	{
-		FPlatformProcess::Sleep(0.1f);
-	}
+	WaitForQueryResult(5.0);
 
 	Actors.Empty();
 	{
@@ -170,6 +184,11 @@ bool FMayaLiveLinkProvider::GetActorsByClass(const FString& ClassName, TMap<FStr
 
 bool FMayaLiveLinkProvider::GetAnimSequencesBySkeleton(TMap<FString, FStringArray>& Assets)
 {
+	if (!CanQuery())
+	{
+		return false;
+	}
+
 	QueriedResultReady = false;
 
 	// Request to get the list of anim sequences by skeleton
@@ -178,11 +197,7 @@ bool FMayaLiveLinkProvider::GetAnimSequencesBySkeleton(TMap<FString, FStringArra
 	SendMessage(Message);
 
 	// Wait for the return message or time out if it takes too long
-	double Start = FPlatformTime::Seconds();
-	while ((FPlatformTime::Seconds() - Start) < 5 && !QueriedResultReady)
-	{
-		FPlatformProcess::Sleep(0.1f);
-	}
+	WaitForQueryResult(5.0);
 
 	Assets.Empty();
 	{
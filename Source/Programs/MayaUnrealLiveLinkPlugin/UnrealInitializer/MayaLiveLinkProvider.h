@@ -89,6 +89,9 @@ public:
 	void OnTimeChange(const FQualifiedFrameTime& FrameTime);
 
 private:
+	bool CanQuery() const;
+	bool WaitForQueryResult(double TimeoutSeconds) const;
+
 	void ResetSourceShutdown()
 	{
 		FScopeLock Lock(&CriticalSection);
@@ -0,0 +1,163 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ProfilingLiveLinkProducer.h"
+
+#include "HAL/PlatformTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	// Memory writer counting how many times the buffer is reallocated while serializing
+	class FAllocationCountingWriter : public FMemoryWriter
+	{
+	public:
+		FAllocationCountingWriter(TArray<uint8>& InBytes)
+		: FMemoryWriter(InBytes)
+		, Buffer(InBytes)
+		{
+		}
+
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			const int32 PreviousMax = Buffer.Max();
+			FMemoryWriter::Serialize(Data, Num);
+			if (Buffer.Max() != PreviousMax)
+			{
+				++Allocations;
+			}
+		}
+
+		uint64 Allocations = 0;
+
+	private:
+		TArray<uint8>& Buffer;
+	};
+
+	// Count the heap blocks owned by a payload, which the receiver allocates again when decoding it
+	uint64 CountPayloadAllocations(const UStruct* Struct, const void* Data)
+	{
+		uint64 Allocations = 0;
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				const void* Value = It->ContainerPtrToValuePtr<void>(Data, ArrayIndex);
+				if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+				{
+					FScriptArrayHelper ArrayHelper(ArrayProperty, Value);
+					if (ArrayHelper.Num() == 0)
+					{
+						continue;
+					}
+
+					++Allocations;
+					if (const FStructProperty* InnerProperty = CastField<FStructProperty>(ArrayProperty->Inner))
+					{
+						for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+						{
+							Allocations += CountPayloadAllocations(InnerProperty->Struct, ArrayHelper.GetRawPtr(Index));
+						}
+					}
+				}
+				else if (const FStrProperty* StrProperty = CastField<FStrProperty>(*It))
+				{
+					Allocations += StrProperty->GetPropertyValue(Value).IsEmpty() ? 0 : 1;
+				}
+				else if (const FStructProperty* StructProperty = CastField<FStructProperty>(*It))
+				{
+					Allocations += CountPayloadAllocations(StructProperty->Struct, Value);
+				}
+			}
+		}
+		return Allocations;
+	}
+}
+
+FProfilingLiveLinkProducer::FProfilingLiveLinkProducer(const FString& InProviderName)
+: ProviderName(InProviderName)
+{
+}
+
+bool FProfilingLiveLinkProducer::UpdateSubjectStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role, FLiveLinkStaticDataStruct&& StaticData)
+{
+	if (bDropMessages)
+	{
+		return false;
+	}
+
+	AddMessage(Role, StaticData.GetStruct(), StaticData.GetBaseData(), true);
+	return true;
+}
+
+void FProfilingLiveLinkProducer::RemoveSubject(const FName& SubjectName)
+{
+	++RemovedSubjects;
+}
+
+bool FProfilingLiveLinkProducer::UpdateSubjectFrameData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role, FLiveLinkFrameDataStruct&& FrameData)
+{
+	if (bDropMessages)
+	{
+		return false;
+	}
+
+	AddMessage(Role, FrameData.GetStruct(), FrameData.GetBaseData(), false);
+	++SubjectFrameMessages.FindOrAdd(SubjectName);
+	return true;
+}
+
+void FProfilingLiveLinkProducer::ResetStats()
+{
+	Stats.Reset();
+	SubjectFrameMessages.Reset();
+	RemovedSubjects = 0;
+}
+
+void FProfilingLiveLinkProducer::AddMessage(TSubclassOf<ULiveLinkRole> Role, const UScriptStruct* Struct, const void* Data, bool bStaticData)
+{
+	FRoleStats& RoleStats = Stats.FindOrAdd(Role ? Role->GetFName() : NAME_None);
+	if (bStaticData)
+	{
+		++RoleStats.StaticDataMessages;
+	}
+	else
+	{
+		++RoleStats.FrameDataMessages;
+	}
+
+	if (!Struct || !Data)
+	{
+		return;
+	}
+
+	// Encode the payload in a new buffer, the same way the message bus serializes each message, then discard it
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<uint8> EncodeBuffer;
+	FAllocationCountingWriter Writer(EncodeBuffer);
+	Struct->SerializeBin(Writer, const_cast<void*>(Data));
+	RoleStats.EncodeSeconds += FPlatformTime::Seconds() - StartTime;
+	RoleStats.Bytes += EncodeBuffer.Num();
+	RoleStats.Allocations += Writer.Allocations;
+	RoleStats.PayloadAllocations += CountPayloadAllocations(Struct, Data);
+}
@@ -0,0 +1,123 @@
+// MIT License
+
+// Copyright (c) 2022 Autodesk, Inc.
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "ILiveLinkProducer.h"
+
+/**
+* Live Link producer that doesn't send anything.
+* It accepts the static and frame data of every subject, gathers statistics per role and discards the payloads.
+* It is used to measure the cost of evaluating and marshalling the subjects without any network cost.
+*/
+class FProfilingLiveLinkProducer : public ILiveLinkProducer
+{
+public:
+	/** Statistics gathered for a Live Link role */
+	struct FRoleStats
+	{
+		uint64 StaticDataMessages = 0;
+		uint64 FrameDataMessages = 0;
+		uint64 Bytes = 0;
+		/** Allocations made by the encoded buffers while serializing the payloads */
+		uint64 Allocations = 0;
+		double EncodeSeconds = 0.0;
+		/** Heap blocks held by the payloads, one per non-empty array or string, allocated again on each side of the wire */
+		uint64 PayloadAllocations = 0;
+	};
+
+	FProfilingLiveLinkProducer(const FString& ProviderName);
+	virtual ~FProfilingLiveLinkProducer() {}
+
+	LiveLinkSource GetSourceType() const override final
+	{
+		return LiveLinkSource::Profiling;
+	}
+
+	/**
+	* Encode and discard the static data of a subject.
+	* @param SubjectName	The name of the subject
+	* @param Role			The Live Link role of the subject. The StaticData type should match the role's data.
+	* @param StaticData		The static data of the subject.
+	* @return				False when the messages are dropped.
+	*/
+	virtual bool UpdateSubjectStaticData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role, FLiveLinkStaticDataStruct&& StaticData) override;
+
+	/**
+	* Count the removal of a subject.
+	* @param SubjectName	The name of the subject.
+	*/
+	virtual void RemoveSubject(const FName& SubjectName) override;
+
+	/**
+	* Encode and discard the frame data of a subject.
+	* @param SubjectName	The name of the subject
+	* @param Role			The Live Link role of the subject. The FrameData type should match the role's data.
+	* @param FrameData		The frame data of the subject.
+	* @return				False when the messages are dropped.
+	*/
+	virtual bool UpdateSubjectFrameData(const FName& SubjectName, TSubclassOf<ULiveLinkRole> Role, FLiveLinkFrameDataStruct&& FrameData) override;
+
+	/** This producer is always ready to accept data. */
+	virtual bool HasConnection() const override { return true; }
+
+	virtual FDelegateHandle RegisterConnStatusChangedHandle(const FMayaLiveLinkProviderConnectionStatusChanged::FDelegate& ConnStatusChanged) override
+	{
+		return OnConnectionStatusChanged.Add(ConnStatusChanged);
+	}
+
+	virtual void UnregisterConnStatusChangedHandle(FDelegateHandle Handle) override
+	{
+		OnConnectionStatusChanged.Remove(Handle);
+	}
+
+	virtual void EnableFileExport(bool Enable, const FString& FilePath = FString()) override final {}
+
+	/** Make the producer fail every send, as if the editor couldn't be reached. */
+	void SetDropMessages(bool bDrop) { bDropMessages = bDrop; }
+
+	/** Get the name given to the producer when it was created. */
+	const FString& GetProviderName() const { return ProviderName; }
+
+	/** Get the statistics gathered since the creation of the producer or the last reset, by role name. */
+	const TMap<FName, FRoleStats>& GetStats() const { return Stats; }
+
+	/** Get the number of frame data messages sent since the creation of the producer or the last reset, by subject name. */
+	const TMap<FName, uint64>& GetSubjectFrameMessages() const { return SubjectFrameMessages; }
+
+	/** Get the number of subjects removed since the creation of the producer or the last reset. */
+	uint64 GetRemovedSubjects() const { return RemovedSubjects; }
+
+	void ResetStats();
+
+private:
+	void AddMessage(TSubclassOf<ULiveLinkRole> Role, const UScriptStruct* Struct, const void* Data, bool bStaticData);
+
+private:
+	FMayaLiveLinkProviderConnectionStatusChanged OnConnectionStatusChanged;
+
+	FString ProviderName;
+	TMap<FName, FRoleStats> Stats;
+	TMap<FName, uint64> SubjectFrameMessages;
+	uint64 RemovedSubjects = 0;
+	bool bDropMessages = false;
+};
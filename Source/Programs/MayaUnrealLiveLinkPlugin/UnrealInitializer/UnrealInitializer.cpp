@@ -24,6 +24,9 @@
 #include "LaunchEngineLoop.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "Features/IModularFeatures.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadManager.h"
 #include "INetworkMessagingExtension.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Modules/ModuleManager.h"
@@ -36,6 +39,21 @@
 #include "FUnrealStreamManager.h"
 #include "FMayaOutputDevice.h"
 
+namespace
+{
+	// Steps of the Unreal initialization, the modules loading steps can be skipped when shutting down
+	enum EInitStep : int32
+	{
+		PreInitPreStartupScreen,
+		PreInitPostStartupScreen,
+		ProcessNewlyLoadedObjects,
+		LoadMessagingModule,
+		LoadPreDefaultModules,
+		LoadDefaultModules,
+		LoadPostDefaultModules,
+	};
+}
+
 //======================================================================
 /*!	\brief Get the singleton Unreal Initializer object
 
@@ -62,28 +80,152 @@ bool UnrealInitializer::HasInitializedOnce() const
 */
 UnrealInitializer::UnrealInitializer()
 : InitializedOnce(false)
+, bUnrealInitialized(false)
+, InitStep(0)
+, InitializationSeconds(0.0)
+, InitialResidentBytes(0)
+, InitProfile(EInitProfile::Minimal)
+, InitialSource(LiveLinkSource::MessageBus)
+, CoreLimit(0)
+{
+}
+
+//======================================================================
+/*!	\brief Set the profile used to initialize Unreal.
+
+	\param[in] InProfile   Modules to load when initializing Unreal.
+	\param[in] InSource    Live link source used when starting live link.
+	\param[in] InCoreLimit Maximum number of cores used to size the worker threads, 0 for no limit.
+*/
+void UnrealInitializer::SetInitProfile(EInitProfile InProfile, LiveLinkSource InSource, int32 InCoreLimit)
 {
+	InitProfile = InProfile;
+	InitialSource = InSource;
+	CoreLimit = InCoreLimit;
 }
 
 //======================================================================
-/*!	\brief Initialize Unreal and set it up for live link
+/*!	\brief Get the memory and threads used since Unreal is running in the Maya process.
+
+	\param[out] ResidentBytes           Resident memory of the Maya process.
+	\param[out] ResidentBytesBeforeInit Resident memory of the Maya process before Unreal started initializing.
+	\param[out] NumThreads              Number of threads created by Unreal.
+*/
+void UnrealInitializer::GetFootprint(uint64& ResidentBytes, uint64& ResidentBytesBeforeInit, int32& NumThreads) const
+{
+	ResidentBytes = FPlatformMemory::GetStats().UsedPhysical;
+	ResidentBytesBeforeInit = InitialResidentBytes;
+
+	NumThreads = 0;
+	FThreadManager::Get().ForEachThread([&NumThreads](uint32 ThreadId, FRunnableThread* Thread) { ++NumThreads; });
+}
+
+//======================================================================
+/*!	\brief Initialize Unreal and set it up for live link, running the remaining initialization steps
 */
 void UnrealInitializer::InitializeUnreal()
 {
-	GEngineLoop.PreInit(TEXT("MayaUnrealLiveLinkPlugin -Messaging -stdout"));
-	ProcessNewlyLoadedUObjects();
+	while (!InitializeUnrealStep())
+	{
+	}
+}
+
+//======================================================================
+/*!	\brief Run the initialization steps needed to shut down the engine.
+
+	The engine loop must be pre-initialized before it can exit. The modules that aren't loaded yet
+	are skipped, they would only be unloaded right away.
+*/
+void UnrealInitializer::InitializeUnrealForShutdown()
+{
+	while (!bUnrealInitialized && InitStep < LoadMessagingModule)
+	{
+		InitializeUnrealStep();
+	}
+}
 
-	// Tell the module manager is may now process newly-loaded UObjects when new C++ modules are loaded
-	FModuleManager::Get().StartProcessingNewlyLoadedObjects();
+//======================================================================
+/*!	\brief Run the next step of the Unreal initialization.
 
-	// Load UdpMessaging module needed by message bus.
-	FModuleManager::Get().LoadModule(TEXT("UdpMessaging"));
+	The engine must be initialized on Maya's main thread since it becomes the game thread,
+	it can't be handed over to another thread afterwards. The initialization is split in steps
+	run from a timer instead so that Maya isn't blocked for the whole initialization.
 
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PreDefault);
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::Default);
-	IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PostDefault);
+	\return True once Unreal is initialized.
+*/
+bool UnrealInitializer::InitializeUnrealStep()
+{
+	if (bUnrealInitialized)
+	{
+		return true;
+	}
 
+	// Reloading the plugin isn't supported once the engine started initializing
 	InitializedOnce = true;
+
+	const double StartTime = FPlatformTime::Seconds();
+	switch (InitStep++)
+	{
+		case PreInitPreStartupScreen:
+			InitialResidentBytes = FPlatformMemory::GetStats().UsedPhysical;
+
+			// Messaging must stay enabled in case the message bus source is selected later on
+			CommandLine = TEXT("MayaUnrealLiveLinkPlugin -Messaging -stdout");
+			if (CoreLimit > 0)
+			{
+				CommandLine += FString::Printf(TEXT(" -corelimit=%d"), CoreLimit);
+			}
+
+			// Same as GEngineLoop.PreInit, in two steps
+			GEngineLoop.PreInitPreStartupScreen(*CommandLine);
+			break;
+
+		case PreInitPostStartupScreen:
+			GEngineLoop.PreInitPostStartupScreen(*CommandLine);
+			break;
+
+		case ProcessNewlyLoadedObjects:
+			ProcessNewlyLoadedUObjects();
+
+			// Tell the module manager is may now process newly-loaded UObjects when new C++ modules are loaded
+			FModuleManager::Get().StartProcessingNewlyLoadedObjects();
+			break;
+
+		case LoadMessagingModule:
+			if (InitProfile == EInitProfile::Minimal)
+			{
+				// The loading phases of the enabled plugins are skipped, only the live link modules used
+				// by the plugin are started. Their UObjects were already registered with the program.
+				FModuleManager::Get().LoadModule(TEXT("LiveLinkInterface"));
+				FModuleManager::Get().LoadModule(TEXT("MayaLiveLinkInterface"));
+			}
+			if (InitProfile == EInitProfile::Full || InitialSource == LiveLinkSource::MessageBus)
+			{
+				// Load UdpMessaging module needed by message bus.
+				// The other sources don't need it, its threads are only started when it's selected.
+				FModuleManager::Get().LoadModule(TEXT("UdpMessaging"));
+				FModuleManager::Get().LoadModule(TEXT("LiveLinkMessageBusFramework"));
+			}
+			bUnrealInitialized = InitProfile == EInitProfile::Minimal;
+			break;
+
+		case LoadPreDefaultModules:
+			IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PreDefault);
+			break;
+
+		case LoadDefaultModules:
+			IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::Default);
+			break;
+
+		case LoadPostDefaultModules:
+		default:
+			IPluginManager::Get().LoadModulesForEnabledPlugins(ELoadingPhase::PostDefault);
+			bUnrealInitialized = true;
+			break;
+	}
+	InitializationSeconds += FPlatformTime::Seconds() - StartTime;
+
+	return bUnrealInitialized;
 }
 
 //======================================================================
@@ -115,8 +257,8 @@ void UnrealInitializer::StartLiveLink(void (*OnChangedCbFp)(), void(*OnTimeChang
 	}
 	else
 	{
-		// We start with message bus as our default provider
-		FUnrealStreamManager::TheOne().SetLiveLinkProvider(LiveLinkSource::MessageBus); // ToDo: Maybe we need a create function instead of set?
+		// We start with the source of the init profile, message bus by default
+		FUnrealStreamManager::TheOne().SetLiveLinkProvider(InitialSource); // ToDo: Maybe we need a create function instead of set?
 		LiveLinkProvider = FUnrealStreamManager::TheOne().GetLiveLinkProvider();
 	}
 
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "FMayaOutputDevice.h"
+#include "ILiveLinkProducer.h"
 
 /*! \class	UnrealInitializer
 *		\brief Class responsible for initializing UE side of things.
@@ -34,8 +35,39 @@ public:
 	//! Singleton object. Use this function to access it.
 	static UnrealInitializer& TheOne();
 
+	//! Modules loaded when initializing Unreal. The minimal profile only loads the modules
+	//! needed by the initial source, the full profile loads every enabled plugin.
+	enum class EInitProfile : uint8
+	{
+		Minimal,
+		Full,
+	};
+
+	//! Must be called before initializing Unreal. A CoreLimit of 0 sizes the worker threads
+	//! from the number of cores of the machine.
+	void SetInitProfile(EInitProfile InProfile, LiveLinkSource InSource, int32 InCoreLimit);
+
+	//! Resident memory of the process, before and since Unreal was initialized, and number of threads created by Unreal
+	void GetFootprint(uint64& ResidentBytes, uint64& ResidentBytesBeforeInit, int32& NumThreads) const;
+
+	//! Run the remaining initialization steps. The engine is initialized on the calling thread,
+	//! which becomes the game thread, so it must always be Maya's main thread.
 	void InitializeUnreal();
 	void UninitializeUnreal();
+
+	//! Run the initialization steps needed to shut down the engine, skipping the modules loading
+	void InitializeUnrealForShutdown();
+
+	//! Run the next initialization step, Maya stays responsive between the steps
+	//! \return True once the engine initialization completed
+	bool InitializeUnrealStep();
+	//! True once the engine started initializing, it must then complete before shutting down the engine
+	bool HasStartedInitialization() const { return InitStep > 0; }
+	//! True once the engine initialization completed
+	bool IsUnrealInitialized() const { return bUnrealInitialized; }
+	//! Seconds spent initializing the engine
+	double GetInitializationSeconds() const { return InitializationSeconds; }
+
 	void StartLiveLink(void (*OnChangedCbFp)(), void(*OnTimeChangedCbFp)(const struct FQualifiedFrameTime&));
 	void StopLiveLink();
 	void AddMayaOutput(PrintToMayaCb Callback);
@@ -43,6 +75,14 @@ public:
 
 private:
 	bool InitializedOnce;
+	bool bUnrealInitialized;
+	int32 InitStep;
+	FString CommandLine;
+	double InitializationSeconds;
+	uint64 InitialResidentBytes;
+	EInitProfile InitProfile;
+	LiveLinkSource InitialSource;
+	int32 CoreLimit;
 	FDelegateHandle ConnectionStatusChangedHandle;
 	FDelegateHandle TimeChangedReceivedHandle;
 
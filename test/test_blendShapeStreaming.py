@@ -378,4 +378,61 @@ class test_blendShapeStreaming(unittest.TestCase):
             self.assertTrue(isTarget2AStreamed, msg="Target2A was not streamed. Target2A is a blend shapes associate with the character we are streaming and should be streamed. Issue occure at frame " + str(frame))
 
         log.info("Completed")
-                    
+
+    def test_blendShapeStreamMasked(self):
+        log = logging.getLogger( "test_blendShapeStreaming.test_blendShapeStreamMasked" )
+        log.info("Started")
+
+        cmds.blendShape('bs1ToStream', edit=True, w=[(0, 0.76), (1, 0.1)])
+        cmds.blendShape('bs2ToStream', edit=True, w=[(0, 1.0)])
+
+        # Add the character and exclude the joint3 sub-tree, the bs2ToStream curve group and the target1B curve
+        cmds.select(nameRootSkeleton, r=True)
+        cmds.LiveLinkChangeSource(2)
+        cmds.LiveLinkAddSelection()
+        subjectPath = cmds.ls(nameRootSkeleton, long=True)[0]
+        cmds.LiveLinkSubjectStreamMask(subjectPath, 'joint3', excludeJoints=True)
+        cmds.LiveLinkSubjectStreamMask(subjectPath, 'bs2ToStream', 'target1B', excludeCurves=True)
+
+        self.assertEqual(cmds.LiveLinkSubjectStreamMask(subjectPath, q=True, excludeJoints=True), ['joint3'])
+        self.assertEqual(cmds.LiveLinkSubjectStreamMask(subjectPath, q=True, excludeCurves=True), ['bs2ToStream', 'target1B'])
+
+        staticDataFilePath = expandFileName(getFileNameForStaticData(nameRootSkeleton))
+        frameData0FilePath = expandFileName(getFileNameForFrameData(nameRootSkeleton, 0))
+        self.__files.append(staticDataFilePath)
+        self.__files.append(frameData0FilePath)
+
+        cmds.LiveLinkExportStaticData(staticDataFilePath)
+        cmds.LiveLinkExportFrameData(frameData0FilePath, 0)
+
+        self.assertTrue(os.path.isfile(staticDataFilePath), msg="Cannot find static data json file.")
+        self.assertTrue(os.path.isfile(frameData0FilePath), msg="Cannot find frame 0 data json file.")
+
+        names = getPropertiesJsonData(staticDataFilePath, True)
+        values = getPropertiesJsonData(frameData0FilePath, False)
+        self.assertEqual(len(values), len(names), msg="The number of properties in the StaticData and the number of properties in the FrameData are not equals. Streaming data to Unreal will fail.")
+        self.assertEqual(sorted(names), ['target1A', 'target1C'], msg="Only the curves that are not excluded by the streaming mask should be streamed.")
+        self.assertAlmostEqual(0.76, values[names.index('target1A')])
+
+        with open(staticDataFilePath) as f:
+            bones = json.load(f)[nameRootSkeleton][1]['BoneHierarchy']
+        with open(frameData0FilePath) as f:
+            transforms = json.load(f)[nameRootSkeleton][2]['BoneTransforms']
+        self.assertEqual(len(bones), 2, msg="The joint3 sub-tree is excluded and should not be streamed.")
+        self.assertEqual(len(transforms), len(bones), msg="Excluded joints should not be evaluated.")
+
+        # Clearing the mask streams everything again
+        cmds.LiveLinkSubjectStreamMask(subjectPath, excludeJoints=True)
+        cmds.LiveLinkSubjectStreamMask(subjectPath, excludeCurves=True)
+        cmds.LiveLinkExportStaticData(staticDataFilePath)
+        names = getPropertiesJsonData(staticDataFilePath, True)
+        self.assertEqual(sorted(names), ['target1A', 'target1B', 'target1C', 'target2A'])
+
+        # Only the joint hierarchy subjects have a streaming mask
+        propRoot = cmds.polyCube(n='maskedProp')[0]
+        cmds.select(propRoot, r=True)
+        cmds.LiveLinkAddSelection()
+        with self.assertRaises(RuntimeError):
+            cmds.LiveLinkSubjectStreamMask(cmds.ls(propRoot, long=True)[0], 'joint3', excludeJoints=True)
+
+        log.info("Completed")
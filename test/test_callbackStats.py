@@ -0,0 +1,73 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import logging
+import unittest
+from utils import *
+
+class test_callbackStats(unittest.TestCase):
+    NumberOfJoints = 200
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+    def tearDown(self):
+        SubjectPaths = cmds.LiveLinkSubjectPaths()
+        if SubjectPaths:
+            for Path in SubjectPaths:
+                cmds.LiveLinkRemoveSubject(Path)
+
+        cmds.file(new = True, force = True)
+        tearDownTest()
+
+    def getStats(self):
+        stats = {}
+        for roleStats in cmds.LiveLinkCallbackStats() or []:
+            # The role display text can contain spaces, the values are at the end
+            values = roleStats.rsplit(' ', 3)
+            stats[values[0]] = [float(value) for value in values[1:]]
+        return stats
+
+    def test_callbacksScaleWithDrivenNodes(self):
+        log = logging.getLogger( "test_callbackStats.test_callbacksScaleWithDrivenNodes" )
+        log.info("Started")
+
+        # Joint chain with a piece of geometry under each joint, the geometry shapes don't drive the skeleton
+        cmds.select(clear=True)
+        joints = [cmds.joint(p=(0, i, 0)) for i in range(self.NumberOfJoints)]
+        for joint in joints:
+            cube = cmds.polyCube()[0]
+            cmds.parent(cube, joint)
+        selectAndAddSubjectsToLiveLink(joints[0], self)
+
+        stats = self.getStats()
+        self.assertEqual(1, len(stats))
+        numSubjects, numCallbacks, registrationMs = list(stats.values())[0]
+        log.info("%d callbacks registered in %.3f ms" % (numCallbacks, registrationMs))
+
+        self.assertEqual(1, numSubjects)
+        # One attribute changed callback per transform, plus the root deletion and renaming callbacks
+        self.assertLessEqual(numCallbacks, 2 * self.NumberOfJoints + 2)
+
+        log.info("Completed")
@@ -0,0 +1,152 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import maya.cmds as cmds
+import unittest
+import socket
+import time
+from utils import *
+
+class test_destinations(unittest.TestCase):
+    NumberOfFrames = 20
+    OptionVars = ['liveLinkJSONEndpoint', 'liveLinkDestinations']
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+        # LiveLinkDestinations saves its settings, keep the user's preferences intact
+        self.optionVars = {name: cmds.optionVar(query=name) for name in self.OptionVars if cmds.optionVar(exists=name)}
+        self.jsonEndpoint = cmds.LiveLinkDestinations(q=True, jsonEndpoint=True)
+        self.destinations = cmds.LiveLinkDestinations(q=True) or []
+        self.receivers = []
+
+        # Sources are 1-based in LiveLinkChangeSource
+        sourceNames = cmds.LiveLinkGetSourceNames()
+        cmds.LiveLinkChangeSource(sourceNames.index("JSON") + 1)
+
+    def tearDown(self):
+        cmds.LiveLinkDestinations(removeAll=True, jsonEndpoint=self.jsonEndpoint)
+        for destination in self.destinations:
+            if destination == 'MessageBus':
+                cmds.LiveLinkDestinations(messageBus=True)
+            elif destination.startswith('JSON:'):
+                cmds.LiveLinkDestinations(addJSON=destination[len('JSON:'):])
+        for receiver in self.receivers:
+            receiver.close()
+
+        for name in self.OptionVars:
+            cmds.optionVar(remove=name)
+            if name not in self.optionVars:
+                continue
+            values = self.optionVars[name]
+            if isinstance(values, list):
+                cmds.optionVar(clearArray=name)
+                for value in values:
+                    cmds.optionVar(stringValueAppend=(name, value))
+            else:
+                cmds.optionVar(stringValue=(name, values))
+
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+        tearDownTest()
+
+    def createReceiver(self):
+        receiver = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        receiver.bind(('127.0.0.1', 0))
+        receiver.setblocking(False)
+        self.receivers.append(receiver)
+        return receiver
+
+    @staticmethod
+    def endpoint(receiver):
+        return '%s:%d' % receiver.getsockname()
+
+    @staticmethod
+    def drain(receiver):
+        datagrams = 0
+        while True:
+            try:
+                receiver.recv(65536)
+                datagrams += 1
+            except (BlockingIOError, socket.error):
+                return datagrams
+
+    def createMovingProp(self):
+        movingProp = cmds.polyCube(n='movingProp')[0]
+        cmds.setKeyframe(movingProp, attribute='translateX', time=1, value=0)
+        cmds.setKeyframe(movingProp, attribute='translateX', time=self.NumberOfFrames, value=10)
+        selectAndAddSubjectsToLiveLink([movingProp], self)
+
+    def streamFrames(self):
+        start = time.perf_counter()
+        for frame in range(1, self.NumberOfFrames + 1):
+            cmds.currentTime(frame)
+            cmds.flushIdleQueue()
+        return (time.perf_counter() - start) * 1000.0 / self.NumberOfFrames
+
+    def test_jsonEndpointChange(self):
+        first = self.createReceiver()
+        second = self.createReceiver()
+        cmds.LiveLinkDestinations(removeAll=True, jsonEndpoint=self.endpoint(first))
+        self.createMovingProp()
+
+        self.streamFrames()
+        self.assertGreater(self.drain(first), 0)
+
+        # The active JSON producer must follow the new endpoint right away
+        self.assertTrue(cmds.LiveLinkDestinations(jsonEndpoint=self.endpoint(second)))
+        self.assertEqual(self.endpoint(second), cmds.LiveLinkDestinations(q=True, jsonEndpoint=True))
+        self.drain(first)
+        self.streamFrames()
+        self.assertGreater(self.drain(second), 0)
+        self.assertEqual(0, self.drain(first))
+
+    def test_fanOutCost(self):
+        self.createMovingProp()
+
+        baselineMs = None
+        for numberOfReceivers in [1, 2, 4, 8]:
+            receivers = [self.createReceiver() for _ in range(numberOfReceivers)]
+            cmds.LiveLinkDestinations(removeAll=True, jsonEndpoint=self.endpoint(receivers[0]))
+            for receiver in receivers[1:]:
+                cmds.LiveLinkDestinations(addJSON=self.endpoint(receiver))
+            cmds.currentTime(0)
+            cmds.flushIdleQueue()
+            for receiver in receivers:
+                self.drain(receiver)
+
+            frameMs = self.streamFrames()
+
+            # Every receiver gets the frames, not only the first one
+            for receiver in receivers:
+                self.assertGreaterEqual(self.drain(receiver), self.NumberOfFrames - 1)
+
+            if baselineMs is None:
+                baselineMs = frameMs
+            perTargetMs = (frameMs - baselineMs) / (numberOfReceivers - 1) if numberOfReceivers > 1 else 0.0
+            print('%d receivers: %.3f ms per frame, %.3f ms per additional target' % (numberOfReceivers, frameMs, perTargetMs))
+
+            for receiver in receivers:
+                receiver.close()
+                self.receivers.remove(receiver)
@@ -0,0 +1,101 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import unittest
+from utils import *
+
+class test_frameSuppression(unittest.TestCase):
+    NumberOfFrames = 10
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+        # Sources are 1-based in LiveLinkChangeSource
+        sourceNames = cmds.LiveLinkGetSourceNames()
+        cmds.LiveLinkChangeSource(sourceNames.index("Profiling") + 1)
+        restoreOptionVarsOnCleanup(['liveLinkFrameHeartbeat'], self)
+        self.heartbeat = cmds.LiveLinkFrameHeartbeat(q=True)
+
+    def tearDown(self):
+        cmds.LiveLinkFrameHeartbeat(seconds=self.heartbeat)
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+        tearDownTest()
+
+    def streamFrames(self):
+        cmds.LiveLinkProfilingStats(reset=True)
+        for frame in range(1, self.NumberOfFrames + 1):
+            cmds.currentTime(frame)
+            cmds.flushIdleQueue()
+
+        stats = cmds.LiveLinkProfilingStats() or []
+        for roleStats in stats:
+            values = roleStats.split()
+            if values[0] == "LiveLinkTransformRole":
+                return float(values[2])
+        return 0
+
+    def test_staticSubjectIsNotResent(self):
+        movingProp = cmds.polyCube(n='movingProp')[0]
+        cmds.setKeyframe(movingProp, attribute='translateX', time=1, value=0)
+        cmds.setKeyframe(movingProp, attribute='translateX', time=self.NumberOfFrames, value=10)
+        staticProp = cmds.polyCube(n='staticProp')[0]
+        selectAndAddSubjectsToLiveLink([movingProp, staticProp], self)
+        cmds.currentTime(0)
+        cmds.flushIdleQueue()
+
+        # Only the moving subject is sent while the heartbeat isn't due
+        cmds.LiveLinkFrameHeartbeat(seconds=1000.0)
+        frameDataMessages = self.streamFrames()
+        self.assertGreaterEqual(frameDataMessages, self.NumberOfFrames - 1)
+        self.assertLessEqual(frameDataMessages, self.NumberOfFrames + 1)
+
+        # Every subject is sent on every frame when the suppression is disabled
+        cmds.LiveLinkFrameHeartbeat(seconds=0.0)
+        self.assertEqual(0.0, cmds.LiveLinkFrameHeartbeat(q=True))
+        frameDataMessages = self.streamFrames()
+        self.assertGreaterEqual(frameDataMessages, 2 * self.NumberOfFrames)
+
+    def test_failedFrameIsResent(self):
+        self.addCleanup(cmds.LiveLinkProfilingStats, dropMessages=False)
+        staticProp = cmds.polyCube(n='staticProp')[0]
+        selectAndAddSubjectsToLiveLink(staticProp, self)
+        cmds.LiveLinkFrameHeartbeat(seconds=1000.0)
+        cmds.currentTime(0)
+        cmds.flushIdleQueue()
+
+        # The moved prop can't reach the editor, it must not be suppressed as unchanged afterwards
+        cmds.LiveLinkProfilingStats(dropMessages=True)
+        cmds.setAttr(staticProp + '.translateX', 5)
+        cmds.currentTime(0)
+        cmds.flushIdleQueue()
+        cmds.LiveLinkProfilingStats(dropMessages=False)
+
+        frameDataMessages = self.streamFrames()
+        self.assertGreaterEqual(frameDataMessages, 1)
+        self.assertLessEqual(frameDataMessages, 2)
+
+    def test_heartbeatIsSaved(self):
+        cmds.LiveLinkFrameHeartbeat(seconds=0.5)
+        self.assertAlmostEqual(0.5, cmds.optionVar(query='liveLinkFrameHeartbeat'))
@@ -0,0 +1,92 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import json
+import os
+import subprocess
+import sys
+import unittest
+from utils import *
+
+# Run in a new Maya session since Unreal is only initialized once per session
+FootprintScript = '''
+import json, os
+import maya.cmds as cmds
+from utils import *
+
+setUpTest()
+
+# Saved by LiveLinkChangeSource in a previous session
+savedSource = os.environ.get('LIVELINK_TEST_SAVED_SOURCE')
+if savedSource:
+    cmds.optionVar(stringValue=('liveLinkSource', savedSource))
+
+loadPlugins()
+cmds.LiveLinkConnectionStatus()
+residentMB, residentMBBeforeUnreal, threads = cmds.LiveLinkUnrealFootprint()
+selectedSource = cmds.LiveLinkGetSelectedSource()
+if isinstance(selectedSource, list):
+    selectedSource = selectedSource[0]
+
+print('FOOTPRINT_RESULTS ' + json.dumps({'residentMB': residentMB, 'residentMBBeforeUnreal': residentMBBeforeUnreal,
+                                         'threads': threads,
+                                         'source': cmds.LiveLinkGetSourceNames()[selectedSource - 1]}))
+'''
+
+class test_initProfile(unittest.TestCase):
+    def setUp(self):
+        setUpTest()
+
+    def tearDown(self):
+        tearDownTest()
+
+    def loadInNewSession(self, profile, savedSource):
+        env = os.environ.copy()
+        env.pop('MAYA_UNREAL_LIVELINK_SOURCE', None)
+        env['MAYA_UNREAL_LIVELINK_INIT_PROFILE'] = profile
+        env['LIVELINK_TEST_SAVED_SOURCE'] = savedSource
+
+        testPath = os.path.abspath(os.path.dirname(__file__))
+        output = subprocess.check_output([sys.executable, '-c', FootprintScript], cwd=testPath, env=env,
+                                         universal_newlines=True)
+        results = None
+        for line in output.splitlines():
+            if line.startswith('FOOTPRINT_RESULTS '):
+                results = json.loads(line[len('FOOTPRINT_RESULTS '):])
+        self.assertIsNotNone(results)
+        print('{} profile with the {} source: {:.0f} threads, {:.1f} MB resident, {:.1f} MB before Unreal'.format(
+            profile, savedSource, results['threads'], results['residentMB'], results['residentMBBeforeUnreal']))
+        return results
+
+    def test_savedSourceIsUsed(self):
+        results = self.loadInNewSession('Minimal', 'Profiling')
+        self.assertEqual('Profiling', results['source'])
+
+    def test_footprint(self):
+        full = self.loadInNewSession('Full', 'MessageBus')
+        minimal = self.loadInNewSession('Minimal', 'MessageBus')
+        minimalWithoutMessageBus = self.loadInNewSession('Minimal', 'JSON')
+
+        # The minimal profile doesn't start the threads of the modules it doesn't load
+        self.assertLessEqual(minimal['threads'], full['threads'])
+        self.assertLessEqual(minimalWithoutMessageBus['threads'], minimal['threads'])
+        for results in [full, minimal, minimalWithoutMessageBus]:
+            self.assertGreaterEqual(results['residentMB'], results['residentMBBeforeUnreal'])
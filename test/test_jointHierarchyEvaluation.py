@@ -0,0 +1,137 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.api.OpenMaya as OpenMaya
+import maya.cmds as cmds
+import logging
+import math
+import os
+import time
+import unittest
+from utils import *
+
+class test_jointHierarchyEvaluation(unittest.TestCase):
+    NumberOfJoints = 1000
+    NumberOfFrames = 50
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+        # Sources are 1-based in LiveLinkChangeSource
+        sourceNames = cmds.LiveLinkGetSourceNames()
+        cmds.LiveLinkChangeSource(sourceNames.index("Profiling") + 1)
+        self.__files = []
+
+    def tearDown(self):
+        SubjectPaths = cmds.LiveLinkSubjectPaths()
+        if SubjectPaths:
+            for Path in SubjectPaths:
+                cmds.LiveLinkRemoveSubject(Path)
+
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+        for f in self.__files:
+            if os.path.exists(f):
+                os.remove(f)
+        tearDownTest()
+
+    def exportBoneTransforms(self, rootName, frame):
+        exportJson(rootName, frame, frame)
+        staticDataFilePath = expandFileName(getFileNameForStaticData(rootName))
+        frameDataFilePath = expandFileName(getFileNameForFrameData(rootName, frame))
+        self.__files += [staticDataFilePath, frameDataFilePath]
+        return getJsonAnimData(frameDataFilePath, rootName, False)
+
+    # Same local matrix as the joint, with a rotation in xyz order and no joint orient
+    def createBakedJoint(self, joint, name):
+        matrix = OpenMaya.MTransformationMatrix(OpenMaya.MMatrix(cmds.xform(joint, q=True, matrix=True, objectSpace=True)))
+        rotation = matrix.rotation(asQuaternion=False)
+        rotation.reorderIt(OpenMaya.MEulerRotation.kXYZ)
+        bakedJoint = cmds.joint(n=name)
+        cmds.setAttr(bakedJoint + '.translate', *matrix.translation(OpenMaya.MSpace.kTransform))
+        cmds.setAttr(bakedJoint + '.rotate', *[math.degrees(angle) for angle in (rotation.x, rotation.y, rotation.z)])
+        return bakedJoint
+
+    def test_rotateOrderAndJointOrient(self):
+        frame = 10
+
+        # Joints using a rotate order and a joint orient, with an animated rotation
+        cmds.select(clear=True)
+        joints = [cmds.joint(n='orientedRoot', p=(1, 2, 3)), cmds.joint(n='orientedChild', p=(0, 4, 0))]
+        cmds.setAttr(joints[0] + '.rotateOrder', 3)
+        cmds.setAttr(joints[0] + '.rotate', 15, 25, 35)
+        cmds.setAttr(joints[0] + '.jointOrient', 5, 0, -10)
+        cmds.setAttr(joints[1] + '.rotateOrder', 5)
+        cmds.setAttr(joints[1] + '.jointOrient', 10, 20, 30)
+        cmds.setKeyframe(joints[1], attribute='rotateY', time=0, value=0)
+        cmds.setKeyframe(joints[1], attribute='rotateY', time=2 * frame, value=90)
+        cmds.setAttr(joints[1] + '.rotateX', 40)
+        cmds.currentTime(frame)
+
+        # The same skeleton with the local matrices baked in plain rotations
+        cmds.select(clear=True)
+        bakedJoints = [self.createBakedJoint(joints[0], 'bakedRoot')]
+        bakedJoints.append(self.createBakedJoint(joints[1], 'bakedChild'))
+
+        orientedTransforms = self.exportBoneTransforms('orientedRoot', frame)
+        bakedTransforms = self.exportBoneTransforms('bakedRoot', frame)
+        self.assertEqual(2, len(orientedTransforms))
+        self.assertEqual(2, len(bakedTransforms))
+
+        for oriented, baked in zip(orientedTransforms, bakedTransforms):
+            self.assertTrue(almostEqual(baked['L'], oriented['L']), msg="Expected location " + str(baked['L']) + " got " + str(oriented['L']))
+            # q and -q are the same rotation
+            self.assertTrue(almostEqual(baked['R'], oriented['R']) or almostEqual([-value for value in baked['R']], oriented['R']),
+                            msg="Expected rotation " + str(baked['R']) + " got " + str(oriented['R']))
+
+        # The baked rotation isn't the rotation of the joint without its rotate order and joint orient
+        self.assertFalse(almostEqual(list(cmds.getAttr(bakedJoints[1] + '.rotate')[0]), list(cmds.getAttr(joints[1] + '.rotate')[0])))
+
+    def test_evaluateLargeHierarchy(self):
+        log = logging.getLogger( "test_jointHierarchyEvaluation.test_evaluateLargeHierarchy" )
+        log.info("Started")
+
+        cmds.select(clear=True)
+        joints = [cmds.joint(p=(0, i, 0)) for i in range(self.NumberOfJoints)]
+        cmds.setAttr(joints[0] + '.rotateOrder', 3)
+        cmds.setAttr(joints[1] + '.jointOrient', 10, 20, 30)
+        cmds.setKeyframe(joints[0], attribute='rotateY', time=0, value=0)
+        cmds.setKeyframe(joints[0], attribute='rotateY', time=self.NumberOfFrames, value=90)
+        selectAndAddSubjectsToLiveLink(joints[0], self)
+        cmds.LiveLinkProfilingStats(reset=True)
+
+        startTime = time.time()
+        for frame in range(self.NumberOfFrames):
+            cmds.currentTime(frame)
+            cmds.flushIdleQueue()
+        elapsedTime = time.time() - startTime
+        log.info("%d joints evaluated in %.3f ms per frame" % (self.NumberOfJoints, elapsedTime * 1000.0 / self.NumberOfFrames))
+
+        stats = {}
+        for roleStats in cmds.LiveLinkProfilingStats() or []:
+            values = roleStats.split()
+            stats[values[0]] = [float(value) for value in values[1:]]
+        self.assertIn("LiveLinkAnimationRole", stats)
+        self.assertGreater(stats["LiveLinkAnimationRole"][1], 0)
+
+        log.info("Completed")
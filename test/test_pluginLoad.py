@@ -0,0 +1,91 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import json
+import os
+import subprocess
+import sys
+import unittest
+from utils import *
+
+# Run in a new Maya session since the plug-in can only be loaded once per session
+LoadScript = '''
+import json, time
+import maya.cmds as cmds
+from utils import *
+
+setUpTest()
+cmds.polyCube(n='queuedCube')
+
+startTime = time.perf_counter()
+loadPlugins()
+loadSeconds = time.perf_counter() - startTime
+
+# The commands that don't need the engine run while it's initializing
+startTime = time.perf_counter()
+version = cmds.LiveLinkGetPluginVersion()
+budget = cmds.LiveLinkStreamSchedule(q=True, budget=True)
+cmds.select('queuedCube', r=True)
+queuedResult = cmds.LiveLinkAddSelection()
+cmds.select(clear=True)
+commandSeconds = time.perf_counter() - startTime
+
+# Querying the connection waits for the engine, the queued commands then run from the idle queue
+startTime = time.perf_counter()
+cmds.LiveLinkConnectionStatus()
+waitSeconds = time.perf_counter() - startTime
+cmds.flushIdleQueue()
+subjects = cmds.LiveLinkSubjectNames() or []
+selection = cmds.ls(selection=True)
+
+print('LOAD_RESULTS ' + json.dumps({'loadSeconds': loadSeconds, 'commandSeconds': commandSeconds,
+                                    'waitSeconds': waitSeconds, 'version': version, 'subjects': subjects,
+                                    'queuedResult': queuedResult, 'selection': selection}))
+'''
+
+class test_pluginLoad(unittest.TestCase):
+    def setUp(self):
+        setUpTest()
+
+    def tearDown(self):
+        tearDownTest()
+
+    def test_loadTime(self):
+        testPath = os.path.abspath(os.path.dirname(__file__))
+        output = subprocess.check_output([sys.executable, '-c', LoadScript], cwd=testPath, env=os.environ.copy(),
+                                         universal_newlines=True)
+        results = None
+        for line in output.splitlines():
+            if line.startswith('LOAD_RESULTS '):
+                results = json.loads(line[len('LOAD_RESULTS '):])
+        self.assertIsNotNone(results)
+        print('Plug-in loaded in {:.3f} s, commands ran in {:.3f} s, waited {:.3f} s for Unreal'.format(
+            results['loadSeconds'], results['commandSeconds'], results['waitSeconds']))
+
+        self.assertTrue(results['version'])
+        self.assertIn('queuedCube', results['subjects'])
+
+        # The queued command has the same result type as the command, and the selection is restored after it ran
+        self.assertEqual([False], results['queuedResult'])
+        self.assertEqual([], results['selection'])
+
+        # The commands that don't need the engine don't wait for its initialization
+        self.assertLess(results['commandSeconds'], 1.0)
@@ -0,0 +1,88 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import json
+import os
+import re
+import subprocess
+import sys
+import unittest
+from utils import *
+
+# Run in a new Maya session since the plug-in can't be loaded again once unloaded
+ShutdownScript = '''
+import json, sys, time
+import maya.cmds as cmds
+from utils import *
+
+setUpTest()
+loadPlugins()
+cmds.polyCube(n='shutdownCube')
+cmds.select('shutdownCube', r=True)
+
+if sys.argv[1] == 'initialized':
+    # Wait for Unreal, no editor is connected
+    cmds.LiveLinkConnectionStatus()
+    cmds.LiveLinkAddSelection()
+else:
+    # Unreal isn't initialized yet, the command is queued and dropped by the shutdown
+    cmds.LiveLinkAddSelection()
+
+pluginName = [name for name in cmds.pluginInfo(q=True, listPlugins=True) if name.startswith('MayaUnrealLiveLinkPlugin_')][0]
+cmds.unloadPlugin('MayaUnrealLiveLinkPluginUI')
+startTime = time.perf_counter()
+cmds.unloadPlugin(pluginName)
+shutdownSeconds = time.perf_counter() - startTime
+
+print('SHUTDOWN_RESULTS ' + json.dumps({'shutdownSeconds': shutdownSeconds}))
+'''
+
+class test_pluginShutdown(unittest.TestCase):
+    # Without an editor, nothing should wait for an answer, e.g. for the asset queries timeout
+    MaxShutdownSeconds = 5.0
+
+    def setUp(self):
+        setUpTest()
+
+    def tearDown(self):
+        tearDownTest()
+
+    def shutdown(self, state):
+        testPath = os.path.abspath(os.path.dirname(__file__))
+        output = subprocess.check_output([sys.executable, '-c', ShutdownScript, state], cwd=testPath, env=os.environ.copy(),
+                                         stderr=subprocess.STDOUT, universal_newlines=True)
+        results = None
+        for line in output.splitlines():
+            if line.startswith('SHUTDOWN_RESULTS '):
+                results = json.loads(line[len('SHUTDOWN_RESULTS '):])
+        self.assertIsNotNone(results)
+        print('Plug-in shut down in {:.3f} s'.format(results['shutdownSeconds']))
+
+        report = re.search(r'MayaUnrealLiveLinkPlugin shut down in [0-9.]+ ms .*, ([0-9]+) queued items dropped', output)
+        self.assertTrue(report)
+        self.assertLess(results['shutdownSeconds'], self.MaxShutdownSeconds)
+        return int(report.group(1))
+
+    def test_shutdownWithoutEditor(self):
+        self.assertEqual(0, self.shutdown('initialized'))
+
+    def test_shutdownDropsQueuedCommands(self):
+        self.assertEqual(1, self.shutdown('initializing'))
@@ -0,0 +1,161 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+import maya.cmds as cmds
+import logging
+import time
+import unittest
+from utils import *
+
+class test_profilingSource(unittest.TestCase):
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+        # Sources are 1-based in LiveLinkChangeSource
+        sourceNames = cmds.LiveLinkGetSourceNames()
+        self.assertIn("Profiling", sourceNames)
+        cmds.LiveLinkChangeSource(sourceNames.index("Profiling") + 1)
+
+    def tearDown(self):
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+
+    def getStats(self):
+        stats = {}
+        for roleStats in cmds.LiveLinkProfilingStats() or []:
+            values = roleStats.split()
+            stats[values[0]] = [float(value) for value in values[1:]]
+        return stats
+
+    def test_profilingStats(self):
+        propRoot = cmds.polyCube()[0]
+        selectAndAddSubjectsToLiveLink(propRoot, self)
+        cmds.LiveLinkSendSubjectList()
+
+        stats = self.getStats()
+        self.assertIn("LiveLinkTransformRole", stats)
+
+        staticDataMessages, frameDataMessages, numBytes, allocations, encodeMs, payloadAllocations = stats["LiveLinkTransformRole"]
+        self.assertGreaterEqual(staticDataMessages, 1)
+        self.assertGreater(numBytes, 0)
+        # Each message is encoded in a new buffer, which is allocated at least once
+        self.assertGreaterEqual(allocations, staticDataMessages)
+        self.assertGreaterEqual(encodeMs, 0)
+
+        self.assertEqual("Maya Live Link Profiling", cmds.LiveLinkProfilingStats(providerName=True))
+
+        # Stats are returned one last time before being reset
+        cmds.LiveLinkProfilingStats(reset=True)
+        self.assertEqual(self.getStats(), {})
+
+    def rebuildSubjects(self):
+        # Changing the anim sequence layout rebuilds the subjects without forgetting what was sent
+        trackMajor = cmds.LiveLinkAnimSequenceLayout(q=True)
+        cmds.LiveLinkAnimSequenceLayout(trackMajor=not trackMajor)
+        cmds.LiveLinkAnimSequenceLayout(trackMajor=trackMajor)
+
+    def restoreAnimSequenceLayoutOption(self):
+        restoreOptionVarsOnCleanup(['liveLinkAnimSequenceTrackLayout'], self)
+
+    def test_unchangedStaticDataIsNotResent(self):
+        self.restoreAnimSequenceLayoutOption()
+        propRoot = cmds.polyCube()[0]
+        selectAndAddSubjectsToLiveLink(propRoot, self)
+        cmds.LiveLinkSendSubjectList()
+
+        cmds.LiveLinkProfilingStats(reset=True)
+        self.rebuildSubjects()
+        stats = self.getStats()
+        self.assertEqual(0, stats.get("LiveLinkTransformRole", [0])[0])
+
+    def test_failedStaticDataIsResent(self):
+        self.restoreAnimSequenceLayoutOption()
+        self.addCleanup(cmds.LiveLinkProfilingStats, dropMessages=False)
+        propRoot = cmds.polyCube()[0]
+        selectAndAddSubjectsToLiveLink(propRoot, self)
+
+        # The static data can't reach the editor, it must not be remembered as sent
+        cmds.LiveLinkProfilingStats(dropMessages=True)
+        cmds.LiveLinkSendSubjectList()
+        cmds.LiveLinkProfilingStats(dropMessages=False)
+
+        cmds.LiveLinkProfilingStats(reset=True)
+        self.rebuildSubjects()
+        stats = self.getStats()
+        self.assertIn("LiveLinkTransformRole", stats)
+        self.assertGreaterEqual(stats["LiveLinkTransformRole"][0], 1)
+
+    def bakeAnimSequence(self, rootJoint, trackMajor):
+        cmds.LiveLinkAnimSequenceLayout(trackMajor=trackMajor)
+        cmds.LiveLinkProfilingStats(reset=True)
+
+        # Linking the subject to an anim sequence bakes the whole playback range
+        startTime = time.time()
+        cmds.LiveLinkLinkUnrealAsset(rootJoint, '/Game/Skeleton', 'Skeleton', '/Game', 'LayoutBake', 'AnimSequence', False)
+        bakeTime = time.time() - startTime
+        cmds.LiveLinkUnlinkUnrealAsset(rootJoint)
+
+        roleName = "MayaLiveLinkAnimSequenceTrackRole" if trackMajor else "MayaLiveLinkAnimSequenceRole"
+        stats = self.getStats()
+        self.assertIn(roleName, stats)
+        return stats[roleName], bakeTime
+
+    def test_animSequenceLayouts(self):
+        log = logging.getLogger("test_profilingSource.test_animSequenceLayouts")
+        self.restoreAnimSequenceLayoutOption()
+
+        numberOfJoints = 20
+        numberOfFrames = 300
+        cmds.select(clear=True)
+        joints = [cmds.joint(p=(0, index, 0)) for index in range(numberOfJoints)]
+        rootJoint = cmds.ls(joints[0], long=True)[0]
+        cmds.playbackOptions(minTime=0, maxTime=numberOfFrames - 1)
+        for joint in joints:
+            cmds.setKeyframe(joint, attribute='rotateZ', time=0, value=0)
+            cmds.setKeyframe(joint, attribute='rotateZ', time=numberOfFrames - 1, value=90)
+        selectAndAddSubjectsToLiveLink(rootJoint, self)
+
+        frameStats, frameBakeTime = self.bakeAnimSequence(rootJoint, False)
+        trackStats, trackBakeTime = self.bakeAnimSequence(rootJoint, True)
+
+        # role staticMessages frameMessages bytes allocations encodeMs payloadAllocations
+        log.info("Frame-major layout: %d bytes, %d payload allocations, %.3f ms encoding, %.3f ms bake" %
+                 (frameStats[2], frameStats[5], frameStats[4], frameBakeTime * 1000.0))
+        log.info("Track-major layout: %d bytes, %d payload allocations, %.3f ms encoding, %.3f ms bake" %
+                 (trackStats[2], trackStats[5], trackStats[4], trackBakeTime * 1000.0))
+
+        # Both layouts send the range in the same chunks
+        self.assertEqual(frameStats[1], trackStats[1])
+        self.assertGreater(trackStats[2], 0)
+        # The track-major layout doesn't repeat the array sizes for every frame
+        self.assertLessEqual(trackStats[2], frameStats[2])
+        # The frame-major layout allocates the locations, rotations and scales of every frame
+        self.assertGreaterEqual(frameStats[5], numberOfFrames * 3)
+        self.assertLess(trackStats[5] * 10, frameStats[5])
+
+    def test_profilingStatsRequiresProfilingSource(self):
+        cmds.LiveLinkChangeSource(1)
+        with self.assertRaises(RuntimeError):
+            cmds.LiveLinkProfilingStats()
@@ -0,0 +1,79 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import logging
+import time
+import unittest
+from utils import *
+
+class test_reparent(unittest.TestCase):
+    NumberOfNodes = 10000
+    # Seconds allowed to process the DAG changes of every reparented node on idle
+    MaxDagChangesTime = 1.0
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+    def tearDown(self):
+        SubjectPaths = cmds.LiveLinkSubjectPaths()
+        if SubjectPaths:
+            for Path in SubjectPaths:
+                cmds.LiveLinkRemoveSubject(Path)
+
+        cmds.file(new = True, force = True)
+        tearDownTest()
+
+    def test_reparentManyNodes(self):
+        log = logging.getLogger( "test_reparent.test_reparentManyNodes" )
+        log.info("Started")
+
+        propRoot = cmds.polyCube(n='prop')[0]
+        selectAndAddSubjectsToLiveLink(propRoot, self)
+
+        nodes = [cmds.createNode('transform') for _ in range(self.NumberOfNodes)]
+        group = cmds.createNode('transform', n='group')
+        cmds.flushIdleQueue()
+        messagesBefore, batchesBefore = cmds.LiveLinkDagChangeStats()
+
+        # Reparent all the nodes at once like an import would, the plugin processes the DAG changes on idle
+        startTime = time.time()
+        cmds.parent(nodes + [propRoot], group)
+        parentTime = time.time() - startTime
+
+        startTime = time.time()
+        cmds.flushIdleQueue()
+        idleTime = time.time() - startTime
+        log.info("Reparented %d nodes in %.3f s, DAG changes processed in %.3f s" % (self.NumberOfNodes, parentTime, idleTime))
+
+        # Every reparent message is processed in a single batch
+        messagesAfter, batchesAfter = cmds.LiveLinkDagChangeStats()
+        self.assertGreaterEqual(messagesAfter - messagesBefore, self.NumberOfNodes + 1)
+        self.assertEqual(1, batchesAfter - batchesBefore)
+        self.assertLess(idleTime, self.MaxDagChangesTime)
+
+        SubjectPaths = cmds.LiveLinkSubjectPaths()
+        self.assertEqual(1, len(SubjectPaths))
+        self.assertEqual('|group|prop', SubjectPaths[0])
+
+        log.info("Completed")
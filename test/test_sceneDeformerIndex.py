@@ -0,0 +1,138 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import maya.cmds as cmds
+import os
+import json
+import unittest
+from utils import *
+
+def createSkeleton(prefix):
+    cmds.select(clear=True)
+    joints = [cmds.joint(n=prefix + str(i), p=(2 * i, 0, 0)) for i in range(3)]
+    cmds.select(clear=True)
+    return joints
+
+def createBlendShapeMesh(name, targetName):
+    mesh = cmds.polyCube(n=name, w=6, h=1, d=1, sx=8)[0]
+    target = cmds.polyCube(n=targetName, w=4, h=1, d=1, sx=8)[0]
+    cmds.blendShape(target, mesh, n='bs_' + name)
+    cmds.delete(target)
+    return mesh
+
+class test_sceneDeformerIndex(unittest.TestCase):
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+        self.files = []
+        cmds.LiveLinkChangeSource(2)
+
+    def tearDown(self):
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+        for f in self.files:
+            if os.path.exists(f):
+                os.remove(f)
+        tearDownTest()
+
+    def addSubject(self, root):
+        cmds.select(root, r=True)
+        cmds.LiveLinkAddSelection()
+        cmds.select(clear=True)
+
+    def getCurveNames(self, subjectName):
+        staticDataFilePath = expandFileName(getFileNameForStaticData(subjectName))
+        self.files.append(staticDataFilePath)
+        cmds.LiveLinkExportStaticData(staticDataFilePath)
+        with open(staticDataFilePath) as f:
+            return json.load(f)[subjectName][2]['Properties']
+
+    def getCallbacks(self):
+        for roleStats in cmds.LiveLinkCallbackStats() or []:
+            values = roleStats.rsplit(' ', 3)
+            if int(float(values[1])) > 0:
+                return int(float(values[2]))
+        return 0
+
+    def test_blendShapeSkinnedAfterIndexing(self):
+        skeletonA = createSkeleton('jointA')
+        createBlendShapeMesh('lateSkinned', 'lateTarget')
+
+        # The index is built with the blend shape on an unskinned mesh, it's associated with every subject
+        self.addSubject(skeletonA[0])
+        self.assertEqual(['lateTarget'], self.getCurveNames(skeletonA[0]))
+
+        # Skinning the mesh indexes the blend shape again, it now only belongs to the skeleton driving the mesh
+        cmds.skinCluster(skeletonA[0], skeletonA[1], skeletonA[2], 'lateSkinned', tsb=True)
+        skeletonB = createSkeleton('jointB')
+        self.addSubject(skeletonB[0])
+        self.assertEqual([], self.getCurveNames(skeletonB[0]))
+
+        # Indexing the blend shape again doesn't duplicate its curves
+        cmds.LiveLinkSendSubjectList()
+        self.assertEqual(['lateTarget'], self.getCurveNames(skeletonA[0]))
+
+    def test_blendShapeIndexedAgainForEachSkinCluster(self):
+        skeleton = createSkeleton('joint')
+        meshes = [createBlendShapeMesh('mesh' + str(i), 'target' + str(i)) for i in range(3)]
+        self.addSubject(skeleton[0])
+
+        # Each new skin cluster indexes the blend shapes of its mesh again, their entries are replaced
+        for mesh in meshes:
+            cmds.skinCluster(skeleton[0], skeleton[1], skeleton[2], mesh, tsb=True)
+            cmds.LiveLinkSendSubjectList()
+            names = self.getCurveNames(skeleton[0])
+            self.assertEqual(len(set(names)), len(names))
+        self.assertEqual(sorted(names), ['target0', 'target1', 'target2'])
+
+    def test_hikCharacterRenamed(self):
+        skeleton = createSkeleton('hikJoint')
+        self.addSubject(skeleton[0])
+        callbacksWithoutEffector = self.getCallbacks()
+        cmds.LiveLinkRemoveSubject(cmds.ls(skeleton[0], long=True)[0])
+
+        # Same connections as a HumanIK character: joint -> character -> control rig <- effector
+        character = cmds.createNode('network', n='Character1')
+        cmds.addAttr(character, ln='Hips', at='message')
+        cmds.addAttr(character, ln='OutputCharacterDefinition', at='message')
+        controlRig = cmds.createNode('network', n='Character1_ControlRig')
+        cmds.addAttr(controlRig, ln='InputCharacterDefinition', at='message')
+        cmds.addAttr(controlRig, ln='Effectors', at='message', multi=True)
+        effector = cmds.createNode('hikIKEffector', n='Character1_Ctrl_HipsEffector')
+        if not cmds.attributeQuery('ControlSet', node=effector, exists=True):
+            cmds.addAttr(effector, ln='ControlSet', at='message')
+        cmds.addAttr(skeleton[0], ln='Character', at='message')
+        cmds.connectAttr(skeleton[0] + '.Character', character + '.Hips')
+        cmds.connectAttr(character + '.OutputCharacterDefinition', controlRig + '.InputCharacterDefinition')
+        cmds.connectAttr(effector + '.ControlSet', controlRig + '.Effectors[0]')
+
+        # The effector is observed along with the skeleton
+        self.addSubject(skeleton[0])
+        callbacksWithEffector = self.getCallbacks()
+        self.assertGreater(callbacksWithEffector, callbacksWithoutEffector)
+        cmds.LiveLinkRemoveSubject(cmds.ls(skeleton[0], long=True)[0])
+
+        # Renaming the character after it was indexed doesn't lose its effectors
+        cmds.rename(character, 'RenamedCharacter')
+        self.addSubject(skeleton[0])
+        self.assertEqual(callbacksWithEffector, self.getCallbacks())
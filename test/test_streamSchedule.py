@@ -0,0 +1,239 @@
+# MIT License
+
+# Copyright (c) 2022 Autodesk, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+import maya.cmds as cmds
+import time
+import unittest
+from utils import *
+
+class test_streamSchedule(unittest.TestCase):
+    NumberOfTicks = 10
+
+    def setUp(self):
+        setUpTest()
+        cmds.file(new = True, force = True)
+        loadPlugins()
+
+        # Sources are 1-based in LiveLinkChangeSource
+        sourceNames = cmds.LiveLinkGetSourceNames()
+        cmds.LiveLinkChangeSource(sourceNames.index("Profiling") + 1)
+        restoreOptionVarsOnCleanup(['streamBudgetMs', 'liveLinkFrameHeartbeat', 'liveLinkPlaybackLookAhead', 'liveLinkRebakeDelay'], self)
+        self.budget = cmds.LiveLinkStreamSchedule(q=True, budget=True)
+        self.heartbeat = cmds.LiveLinkFrameHeartbeat(q=True)
+        self.lookAhead = cmds.LiveLinkPlaybackLookAhead(q=True)
+        self.rebakeDelay = cmds.LiveLinkRebakeDelay(q=True)
+
+        # Send every due subject, even when its frame didn't change
+        cmds.LiveLinkFrameHeartbeat(seconds=0.0)
+
+    def tearDown(self):
+        cmds.LiveLinkStreamSchedule(budget=self.budget)
+        cmds.LiveLinkFrameHeartbeat(seconds=self.heartbeat)
+        cmds.LiveLinkPlaybackLookAhead(frames=self.lookAhead)
+        cmds.LiveLinkRebakeDelay(seconds=self.rebakeDelay)
+        cmds.file(new = True, force = True)
+        cmds.LiveLinkChangeSource(1)
+        tearDownTest()
+
+    def addSubjects(self, names):
+        nodes = [cmds.polyCube(n=name)[0] for name in names]
+        selectAndAddSubjectsToLiveLink(nodes, self)
+
+        # Selected subjects are high priority
+        cmds.select(clear=True)
+        cmds.flushIdleQueue()
+        return dict(zip(cmds.LiveLinkSubjectPaths(), cmds.LiveLinkSubjectNames()))
+
+    def streamTicks(self, numberOfTicks=NumberOfTicks, playing=False):
+        cmds.LiveLinkProfilingStats(reset=True)
+        for _ in range(numberOfTicks):
+            cmds.LiveLinkStreamTick(playing=playing)
+
+        frameMessages = {}
+        for subjectStats in cmds.LiveLinkProfilingStats(subjects=True) or []:
+            name, count = subjectStats.split()
+            frameMessages[name] = float(count)
+        return frameMessages
+
+    def test_roundRobinWithHighPrioritySubjects(self):
+        subjects = self.addSubjects(['hero1', 'hero2', 'hero3', 'propA', 'propB'])
+        heroes = [path for path in subjects if 'hero' in path]
+        props = [path for path in subjects if 'prop' in path]
+        for path in heroes:
+            cmds.LiveLinkStreamSchedule(path, highPriority=True)
+
+        # Only one normal priority subject fits in the budget after the high priority subjects
+        cmds.LiveLinkStreamSchedule(budget=0.000001)
+        frameMessages = self.streamTicks()
+
+        for path in heroes:
+            self.assertEqual(self.NumberOfTicks, frameMessages.get(subjects[path], 0))
+        for path in props:
+            self.assertEqual(self.NumberOfTicks / 2, frameMessages.get(subjects[path], 0))
+
+    def test_targetRate(self):
+        subjects = self.addSubjects(['propA', 'propB'])
+        paths = list(subjects)
+
+        # Without budget, a subject whose rate isn't due is skipped without starving the others
+        cmds.LiveLinkStreamSchedule(budget=0.0)
+        cmds.LiveLinkStreamSchedule(paths[0], rate=0.001)
+        self.assertAlmostEqual(0.001, cmds.LiveLinkStreamSchedule(paths[0], q=True, rate=True))
+        frameMessages = self.streamTicks()
+
+        self.assertLessEqual(frameMessages.get(subjects[paths[0]], 0), 1)
+        self.assertEqual(self.NumberOfTicks, frameMessages.get(subjects[paths[1]], 0))
+
+    def test_budgetIsSaved(self):
+        cmds.LiveLinkStreamSchedule(budget=2.5)
+        self.assertAlmostEqual(2.5, cmds.optionVar(query='streamBudgetMs'))
+
+    def setUpPlayback(self, lookAhead):
+        cmds.playbackOptions(minTime=1, maxTime=100)
+        cmds.currentTime(1)
+        cmds.LiveLinkPlaybackLookAhead(frames=lookAhead)
+
+    def test_playbackRangeBurstRebakesOnce(self):
+        self.addSubjects(['rangeProp'])
+        cmds.LiveLinkRebakeDelay(seconds=0.3)
+        rebakes = cmds.LiveLinkRebakeDelay(rebakes=True)
+
+        # Dragging the range slider changes the playback range many times in a row
+        for maxTime in range(50, 70):
+            cmds.playbackOptions(minTime=1, maxTime=maxTime)
+            cmds.LiveLinkRebakeDelay(tick=True)
+        self.assertEqual(rebakes, cmds.LiveLinkRebakeDelay(rebakes=True))
+
+        # The range stayed the same for the delay, the whole burst is baked once
+        time.sleep(0.4)
+        cmds.LiveLinkRebakeDelay(tick=True)
+        cmds.LiveLinkRebakeDelay(tick=True)
+        self.assertEqual(rebakes + 1, cmds.LiveLinkRebakeDelay(rebakes=True))
+
+    def test_playbackLookAhead(self):
+        subjects = self.addSubjects(['propA', 'propB'])
+        cmds.LiveLinkStreamSchedule(budget=0.0)
+        self.setUpPlayback(4)
+
+        # The current frame and the 4 upcoming ones are sent on the first tick
+        frameMessages = self.streamTicks(1, playing=True)
+        for name in subjects.values():
+            self.assertEqual(5, frameMessages.get(name, 0))
+
+        # The window was already sent
+        frameMessages = self.streamTicks(1, playing=True)
+        for name in subjects.values():
+            self.assertEqual(0, frameMessages.get(name, 0))
+
+        # Not playing, the subjects are streamed at the current time
+        frameMessages = self.streamTicks(1)
+        for name in subjects.values():
+            self.assertEqual(1, frameMessages.get(name, 0))
+
+    def test_playbackLookAheadRestartsOnEdit(self):
+        subjects = self.addSubjects(['propA'])
+        cmds.LiveLinkStreamSchedule(budget=0.0)
+        self.setUpPlayback(4)
+        self.streamTicks(1, playing=True)
+
+        # The frames sent ahead don't have the edit, the whole window is sent again
+        cmds.setAttr('propA.translateX', 5.0)
+        frameMessages = self.streamTicks(1, playing=True)
+        self.assertEqual(5, frameMessages.get(subjects[list(subjects)[0]], 0))
+
+    def test_playbackLookAheadBudget(self):
+        subjects = self.addSubjects(['propA', 'propB'])
+        self.setUpPlayback(4)
+
+        # Only the first frame fits in the budget, the rest of the window is sent on the next ticks
+        cmds.LiveLinkStreamSchedule(budget=0.000001)
+        frameMessages = self.streamTicks(1, playing=True)
+        self.assertEqual(1, sum(frameMessages.values()))
+
+        # A frame is finished before the window moves on, every subject is sent once per frame
+        frameMessages = self.streamTicks(5, playing=True)
+        self.assertEqual(9, sum(frameMessages.values()))
+        for name in subjects.values():
+            self.assertGreaterEqual(frameMessages.get(name, 0), 4)
+
+        frameMessages = self.streamTicks(1, playing=True)
+        self.assertEqual(0, sum(frameMessages.values()))
+
+    def test_playbackLookAheadDoesNotDelayLiveStream(self):
+        subjects = self.addSubjects(['propA'])
+        path, name = list(subjects.items())[0]
+        cmds.LiveLinkStreamSchedule(budget=0.0)
+        cmds.LiveLinkStreamSchedule(path, rate=10.0)
+        self.setUpPlayback(30)
+        self.streamTicks(1, playing=True)
+
+        # The frames stamped ahead of time don't hold back the subject once the playback stops
+        time.sleep(0.2)
+        frameMessages = self.streamTicks(1)
+        self.assertEqual(1, frameMessages.get(name, 0))
+
+    def test_selectedSubjectIsHighPriority(self):
+        subjects = self.addSubjects(['propA', 'propB', 'propC'])
+        selectedName = subjects[[path for path in subjects if 'propC' in path][0]]
+        cmds.LiveLinkStreamSchedule(budget=0.000001)
+
+        cmds.select('propC', replace=True)
+        frameMessages = self.streamTicks()
+        self.assertEqual(self.NumberOfTicks, frameMessages.get(selectedName, 0))
+
+        # The cached selection follows the selection changes
+        cmds.select(clear=True)
+        frameMessages = self.streamTicks()
+        self.assertLess(frameMessages.get(selectedName, 0), self.NumberOfTicks)
+
+    def test_heroRateWithGrowingBackground(self):
+        subjects = self.addSubjects(['hero'])
+        heroPath, heroName = list(subjects.items())[0]
+        cmds.LiveLinkStreamSchedule(heroPath, highPriority=True)
+        cmds.LiveLinkStreamSchedule(budget=0.5)
+
+        numberOfTicks = 50
+        for numberOfBackgroundSubjects in [10, 50, 200]:
+            numberOfSubjects = len(cmds.LiveLinkSubjectNames()) - 1
+            background = [cmds.polyCube()[0] for _ in range(numberOfBackgroundSubjects - numberOfSubjects)]
+            cmds.select(background, replace=True)
+            cmds.LiveLinkAddSelection()
+            cmds.select(clear=True)
+
+            cmds.LiveLinkProfilingStats(reset=True)
+            tickMs = []
+            for _ in range(numberOfTicks):
+                startTime = time.perf_counter()
+                cmds.LiveLinkStreamTick()
+                tickMs.append((time.perf_counter() - startTime) * 1000.0)
+
+            frameMessages = {}
+            for subjectStats in cmds.LiveLinkProfilingStats(subjects=True) or []:
+                name, count = subjectStats.split()
+                frameMessages[name] = float(count)
+
+            meanMs = sum(tickMs) / numberOfTicks
+            jitterMs = (sum((ms - meanMs) ** 2 for ms in tickMs) / numberOfTicks) ** 0.5
+            print('%d background subjects: %.3f ms per tick, %.3f ms jitter' % (numberOfBackgroundSubjects, meanMs, jitterMs))
+
+            # The hero is served on every tick and the budget keeps the ticks steady
+            self.assertEqual(numberOfTicks, frameMessages.get(heroName, 0))
+            self.assertLess(jitterMs, 5.0)
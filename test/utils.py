@@ -213,6 +213,21 @@ def selectAndAddSubjectsToLiveLink(subjects, unittest):
     unittest.assertEqual(objectLen, len(SubjectTypes))
     unittest.assertEqual(objectLen, len(SubjectRoles))
 
+# The commands changing a setting save it in an optionVar, put the optionVars back once the test is done
+def restoreOptionVarsOnCleanup(names, unittest):
+    for name in names:
+        if not cmds.optionVar(exists=name):
+            unittest.addCleanup(cmds.optionVar, remove=name)
+            continue
+
+        value = cmds.optionVar(query=name)
+        if isinstance(value, int):
+            unittest.addCleanup(cmds.optionVar, intValue=(name, value))
+        elif isinstance(value, float):
+            unittest.addCleanup(cmds.optionVar, floatValue=(name, value))
+        else:
+            unittest.addCleanup(cmds.optionVar, stringValue=(name, value))
+
 def almostEqual(list1, list2):
     if isinstance(list1, list) and isinstance(list2, list) and len(list1) == len(list2):
         return all(math.isclose(*values, abs_tol=1e-04) for values in zip(list1, list2))